@@ -140,7 +140,9 @@ public:
      * Return a VisIt data writer object to be used to output Lagrangian data.
      *
      * If the application is not configured to use VisIt, a NULL pointer will be
-     * returned.
+     * returned.  The number of MPI processes that write to each Silo data file
+     * is set by the optional <TT>silo_number_procs_per_file</TT> entry of the
+     * <TT>Main</TT> input database, which defaults to 1.
      */
     SAMRAI::tbox::Pointer<LSiloDataWriter> getLSiloDataWriter() const;
 
@@ -249,6 +249,19 @@ public:
      */
     void deallocateSolverState();
 
+    /*!
+     * \brief Reset the coefficients of the Laplace operator without
+     * reinitializing the solver state.
+     *
+     * When the solver is initialized and the structure of the stencil is
+     * unchanged, the values of the existing hypre matrices are reset and the
+     * hypre solver is set up again.  The hypre grid, stencil, and vectors are
+     * reused.
+     *
+     * \see PoissonSolver::updatePoissonSpecifications()
+     */
+    bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
+
     //\}
 
 private:
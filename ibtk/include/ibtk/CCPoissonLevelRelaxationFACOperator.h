@@ -161,6 +161,15 @@ public:
      */
     void setCoarseSolverType(const std::string& coarse_solver_type);
 
+    /*!
+     * \brief Reset the coefficients of the Laplace operator without
+     * reinitializing the operator state.
+     *
+     * The level solvers and the coarse level solver are updated via
+     * PoissonSolver::updatePoissonSpecifications().
+     */
+    bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
+
     //\}
 
     /*!
@@ -165,6 +165,17 @@ public:
      */
     void setCoarseSolverType(const std::string& coarse_solver_type);
 
+    /*!
+     * \brief Reset the coefficients of the Laplace operator without
+     * reinitializing the operator state.
+     *
+     * The smoother and residual evaluation use the current coefficients
+     * directly, so the operator state remains valid provided that the
+     * coefficients remain constant.  The coarse level solver, if any, is
+     * updated via PoissonSolver::updatePoissonSpecifications().
+     */
+    bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
+
     //\}
 
     /*!
@@ -74,6 +74,11 @@ namespace IBTK
  * stand-alone solver; rather, it is intended to be used in conjunction with an
  * iterative Krylov method.
  *
+ * Temporary vectors required by the FAC cycle are allocated when the solver
+ * state is initialized and are retained until the solver state is
+ * deallocated.  Consequently, the preconditioner should be initialized via
+ * initializeSolverState() before it is applied repeatedly.
+ *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
 
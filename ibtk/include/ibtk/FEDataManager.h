@@ -51,11 +51,14 @@
 #include "RefineSchedule.h"
 #include "StandardTagAndInitStrategy.h"
 #include "VariableContext.h"
+#include "boost/array.hpp"
 #include "boost/multi_array.hpp"
 #include "ibtk/ibtk_utilities.h"
 #include "libmesh/auto_ptr.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_quadrature_type.h"
+#include "libmesh/fe_base.h"
+#include "libmesh/fe_type.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
 
@@ -109,7 +112,7 @@ public:
      */
     struct InterpSpec
     {
-        InterpSpec()
+        InterpSpec() : use_cell_sorted_kernels(false)
         {
         }
 
@@ -118,13 +121,15 @@ public:
                    const libMesh::Order& quad_order,
                    bool use_adaptive_quadrature,
                    double point_density,
-                   bool use_consistent_mass_matrix)
+                   bool use_consistent_mass_matrix,
+                   bool use_cell_sorted_kernels = false)
             : kernel_fcn(kernel_fcn),
               quad_type(quad_type),
               quad_order(quad_order),
               use_adaptive_quadrature(use_adaptive_quadrature),
               point_density(point_density),
-              use_consistent_mass_matrix(use_consistent_mass_matrix)
+              use_consistent_mass_matrix(use_consistent_mass_matrix),
+              use_cell_sorted_kernels(use_cell_sorted_kernels)
         {
         }
 
@@ -134,6 +139,7 @@ public:
         bool use_adaptive_quadrature;
         double point_density;
         bool use_consistent_mass_matrix;
+        bool use_cell_sorted_kernels;
     };
 
     /*!
@@ -143,7 +149,7 @@ public:
      */
     struct SpreadSpec
     {
-        SpreadSpec()
+        SpreadSpec() : use_threaded_spreading(false), use_cell_sorted_kernels(false)
         {
         }
 
@@ -151,12 +157,16 @@ public:
                    const libMesh::QuadratureType& quad_type,
                    const libMesh::Order& quad_order,
                    bool use_adaptive_quadrature,
-                   double point_density)
+                   double point_density,
+                   bool use_threaded_spreading = false,
+                   bool use_cell_sorted_kernels = false)
             : kernel_fcn(kernel_fcn),
               quad_type(quad_type),
               quad_order(quad_order),
               use_adaptive_quadrature(use_adaptive_quadrature),
-              point_density(point_density)
+              point_density(point_density),
+              use_threaded_spreading(use_threaded_spreading),
+              use_cell_sorted_kernels(use_cell_sorted_kernels)
         {
         }
 
@@ -165,6 +175,8 @@ public:
         libMesh::Order quad_order;
         bool use_adaptive_quadrature;
         double point_density;
+        bool use_threaded_spreading;
+        bool use_cell_sorted_kernels;
     };
 
     /*!
@@ -632,6 +644,40 @@ private:
      */
     FEDataManager& operator=(const FEDataManager& that);
 
+    /*!
+     * Return a quadrature rule of the specified type that has been initialized
+     * for the type and p-refinement level of the given element.  When adaptive
+     * quadrature is used, the order of the rule is determined from the size of
+     * the element.  Quadrature rules are cached and are reused whenever the
+     * same rule is requested for an element of the same type.
+     */
+    libMesh::QBase* getCachedQuadratureRule(libMesh::QuadratureType quad_type,
+                                            libMesh::Order quad_order,
+                                            bool use_adaptive_quadrature,
+                                            double point_density,
+                                            libMesh::Elem* elem,
+                                            const boost::multi_array<double, 2>& X_node,
+                                            double dx_min);
+
+    /*!
+     * Return an FE object of the specified type that is attached to a cached
+     * quadrature rule.  The shape function values are computed when the object
+     * is built and do not need to be recomputed until the object is
+     * reinitialized for an element of a different type.
+     */
+    libMesh::FEBase* getCachedFE(const libMesh::FEType& fe_type, libMesh::QBase* qrule, libMesh::Elem* elem);
+
+    /*!
+     * Return a scratch patch data index that is a clone of the specified patch
+     * data index, registering a new index only when necessary.
+     */
+    int getSpreadScratchDataIndex(int f_data_idx);
+
+    /*!
+     * Deallocate and remove all scratch patch data used when spreading.
+     */
+    void clearSpreadScratchData();
+
     /*!
      * Compute the quadrature point counts in each cell of the level in which
      * the FE mesh is embedded.  Also zeros out node count data for other levels
@@ -768,6 +814,25 @@ private:
     std::map<std::string, libMesh::NumericVector<double>*> d_L2_proj_matrix_diag;
     std::map<std::string, libMesh::QuadratureType> d_L2_proj_quad_type;
     std::map<std::string, libMesh::Order> d_L2_proj_quad_order;
+
+    /*
+     * Scratch patch data indices used when spreading, keyed by the patch data
+     * index of the Eulerian data, along with workspaces for the values at the
+     * quadrature points used when spreading and interpolating.  The scratch
+     * patch data is retained between calls to spread() and is freed whenever
+     * the hierarchy configuration is reset.
+     */
+    std::map<int, int> d_spread_scratch_idxs;
+    std::vector<double> d_F_qp_workspace, d_X_qp_workspace;
+
+    /*
+     * Cached quadrature rules, keyed by element type, quadrature type,
+     * quadrature order, and p-refinement level, along with cached FE objects
+     * keyed by FE type and quadrature rule.
+     */
+    typedef boost::array<int, 4> QuadratureKey;
+    std::map<QuadratureKey, libMesh::QBase*> d_qrule_cache;
+    std::map<std::pair<libMesh::FEType, libMesh::QBase*>, libMesh::FEBase*> d_fe_cache;
 };
 } // namespace IBTK
 
@@ -925,6 +925,13 @@ protected:
     SAMRAI::tbox::Pointer<HierarchyMathOps> d_hier_math_ops;
     bool d_manage_hier_math_ops;
 
+    /*
+     * The number of threads used by the HierarchyMathOps object managed by
+     * this integrator.  Integrators that share the HierarchyMathOps object of
+     * a parent integrator use the setting of the parent.
+     */
+    int d_hier_math_ops_num_threads;
+
     /*
      * SAMRAI::hier::Variable lists and SAMRAI::hier::ComponentSelector objects
      * are used for data management.
@@ -92,6 +92,16 @@ namespace IBTK
  * "composite-grid" mathematical operations on a range of levels in a
  * SAMRAI::hier::PatchHierarchy object.
  *
+ * The patches of each level are independent, so when the library is configured
+ * with --enable-openmp, the local patches of each level may be distributed
+ * among several threads.  The number of threads is one by default.  It may be
+ * set for each object through the constructor or setNumberOfThreads().  The
+ * HierarchyMathOps object managed by a HierarchyIntegrator uses the number of
+ * threads given by the \p hier_math_ops_num_threads input key of that
+ * integrator.
+ * Operations that require patch-local boundary condition objects or temporary
+ * patch data (rot() and strain_rate()) are always performed serially.
+ *
  * \note All specified variable descriptor indices must refer to
  * SAMRAI::hier::Variable / SAMRAI::hier::VariableContext pairs that have been
  * registered with the SAMRAI::hier::VariableDatabase.
@@ -108,13 +118,35 @@ public:
                      SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                      int coarsest_ln = -1,
                      int finest_ln = -1,
-                     const std::string& coarsen_op_name = "CONSERVATIVE_COARSEN");
+                     const std::string& coarsen_op_name = "CONSERVATIVE_COARSEN",
+                     int num_threads = 1);
 
     /*!
      * \brief Destructor.
      */
     ~HierarchyMathOps();
 
+    /*!
+     * \name Methods to control threading.
+     */
+    //\{
+
+    /*!
+     * \brief Set the number of threads used to process the local patches of
+     * each patch level.
+     *
+     * \note Threading has no effect unless the library is built with OpenMP.
+     */
+    void setNumberOfThreads(int num_threads);
+
+    /*!
+     * \brief Get the number of threads used to process the local patches of
+     * each patch level.
+     */
+    int getNumberOfThreads() const;
+
+    //\}
+
     /*!
      * \name Methods to set the hierarchy and range of levels.
      */
@@ -1294,6 +1326,9 @@ private:
     int d_wgt_cc_idx, d_wgt_fc_idx, d_wgt_sc_idx;
     bool d_using_wgt_cc, d_using_wgt_fc, d_using_wgt_sc;
     double d_volume;
+
+    // Threading settings.
+    int d_num_threads;
 };
 } // namespace IBTK
 
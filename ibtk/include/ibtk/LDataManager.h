@@ -43,6 +43,7 @@
 #include <vector>
 
 #include "BasePatchLevel.h"
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
@@ -205,6 +206,33 @@ public:
      */
     const std::string& getDefaultSpreadKernelFunction() const;
 
+    /*!
+     * \brief Set whether to use thread-parallel (colored) spreading when
+     * spreading data from the Lagrangian mesh to the Eulerian grid.
+     *
+     * \see LEInteractor
+     */
+    void setUseThreadedSpreading(bool use_threaded_spreading);
+
+    /*!
+     * \brief Indicate whether thread-parallel (colored) spreading is used.
+     */
+    bool getUseThreadedSpreading() const;
+
+    /*!
+     * \brief Set whether to use the cell-sorted interaction kernels when
+     * interpolating and spreading with kernel functions for which they are
+     * available.
+     *
+     * \see LEInteractor
+     */
+    void setUseCellSortedKernels(bool use_cell_sorted_kernels);
+
+    /*!
+     * \brief Indicate whether the cell-sorted interaction kernels are used.
+     */
+    bool getUseCellSortedKernels() const;
+
     /*!
      * \brief Spread a quantity from the Lagrangian mesh to the Eulerian grid
      * using the default spreading kernel function.
@@ -787,6 +815,27 @@ public:
      */
     void endDataRedistribution(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \brief Enable or disable incremental redistribution of the Lagrangian
+     * data.
+     *
+     * When enabled, endDataRedistribution() preserves the relative ordering of
+     * the nodes that remain on each process for any level whose patch boxes
+     * and processor assignments are unchanged since the previous
+     * redistribution.  Nodes that arrive from other processes are appended to
+     * the local ordering.  If no node changes processes on such a level, the
+     * existing PETSc AO and the layout of the LData are kept, so that only the
+     * ghost (nonlocal) index lists are updated and no data are scattered.  If
+     * the patch configuration of a level changes, its distribution data are
+     * rebuilt from scratch.
+     */
+    void setUseIncrementalDataRedistribution(bool use_incremental_data_redistribution);
+
+    /*!
+     * \brief Indicate whether incremental redistribution is enabled.
+     */
+    bool getUseIncrementalDataRedistribution() const;
+
     /*!
      * \brief Update the workload and count of nodes per cell.
      *
@@ -795,12 +844,86 @@ public:
      * node count data is used to tag cells for refinement, and to specify
      * non-uniform load balancing.  The workload per cell is defined by
      *
-     *    workload(i) = 1 + beta_work*node_count(i)
+     *    workload(i) = 1 + beta_work*node_count(i) + beta_spring*spring_count(i) + beta_patch/patch_size
+     *
+     * in which spring_count(i) is the number of springs associated with the
+     * nodes in cell i, as determined by the callback registered via
+     * registerSpringCountCallback(), and patch_size is the number of cells in
+     * the patch containing cell i.  By default, beta_work is 1, and
+     * beta_spring and beta_patch are 0.
      *
-     * in which alpha and beta are parameters that each default to the value 1.
+     * \note If measured workload estimates are enabled, beta_work,
+     * beta_spring, and beta_patch are first recalibrated each time this
+     * routine is called, both for the full patch hierarchy and for individual
+     * levels, provided that time has been accumulated by the workload timers
+     * since the previous calibration.
+     *
+     * \see setUseMeasuredWorkloadEstimates
      */
     void updateWorkloadEstimates(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \brief Enable or disable workload estimates that are calibrated using
+     * measured execution times.
+     *
+     * When enabled, the cost of each category of work is fit separately using
+     * the wallclock time accumulated by the corresponding timers on each MPI
+     * process since the previous calibration:
+     *
+     *    - marker work (by default, the timers for spread() and interp()) is
+     *      modeled as c_marker*num_local_nodes;
+     *    - force generator work (the timers in \a force_timer_names) is
+     *      modeled as c_force*num_local_nodes + c_spring*num_local_springs;
+     *      and
+     *    - Eulerian work (the timers in \a eul_timer_names) is modeled as
+     *      c_cell*num_local_cells + c_patch*num_local_patches.
+     *
+     * The coefficients are determined by nonnegative least-squares fits over
+     * all MPI processes.  beta_work is set to (c_marker + c_force)/c_cell,
+     * beta_spring to c_spring/c_cell, and beta_patch to c_patch/c_cell.  The
+     * spring counts are zero unless a callback has been registered via
+     * registerSpringCountCallback().  The
+     * numbers of local nodes and cells are sampled, and the timer reference
+     * values are reset, by the first call to spread() or interp() following
+     * each change to the patch hierarchy, so that the counts correspond to the
+     * configuration that was timed.  Each
+     * calibration also logs the load imbalance (maximum over mean of the
+     * per-process load) predicted by the calibrated model along with the
+     * measured load imbalance for the preceding interval.
+     *
+     * \note The named timers must exist and be active (see
+     * SAMRAI::tbox::TimerManager) by the time that the workload is first
+     * sampled; otherwise, an unrecoverable error occurs.  At least one
+     * Eulerian timer must be specified.  If no marker or Eulerian time has
+     * been accumulated since the previous calibration, the coefficients are
+     * left unchanged.
+     */
+    void setUseMeasuredWorkloadEstimates(bool use_measured_workload_estimates,
+                                         const std::vector<std::string>& marker_timer_names,
+                                         const std::vector<std::string>& force_timer_names,
+                                         const std::vector<std::string>& eul_timer_names);
+
+    /*!
+     * \brief Indicate whether measured workload estimates are enabled.
+     */
+    bool getUseMeasuredWorkloadEstimates() const;
+
+    /*!
+     * Callback function specification to determine the number of springs
+     * associated with a local Lagrangian node for the purpose of estimating
+     * the workload.
+     */
+    typedef int (*SpringCountCallbackFcnPtr)(const LNode& node, void* ctx);
+
+    /*!
+     * Register a callback function to determine the number of springs
+     * associated with each Lagrangian node.
+     *
+     * \see updateWorkloadEstimates
+     * \see setUseMeasuredWorkloadEstimates
+     */
+    void registerSpringCountCallback(SpringCountCallbackFcnPtr callback, void* ctx = NULL);
+
     /*!
      * \brief Update the count of nodes per cell.
      *
@@ -986,15 +1109,29 @@ private:
      * Since each processor may own multiple patches in a given level, nodes
      * appearing in the ghost cell region of a patch may or may not be owned by
      * this processor.
+     *
+     * If \a preserve_local_ordering is true, nodes that were local to this
+     * processor prior to the call retain their relative ordering, and nodes
+     * that are new to this processor are appended.  If the resulting local
+     * ordering is unchanged on every processor, the existing AO for the level
+     * is used, \a ao is not created, and the method returns true.  Otherwise,
+     * the method returns false.
      */
-    void computeNodeDistribution(AO& ao,
+    bool computeNodeDistribution(AO& ao,
                                  std::vector<int>& local_lag_indices,
                                  std::vector<int>& nonlocal_lag_indices,
                                  std::vector<int>& local_petsc_indices,
                                  std::vector<int>& nonlocal_petsc_indices,
                                  unsigned int& num_nodes,
                                  unsigned int& node_offset,
-                                 int level_number);
+                                 int level_number,
+                                 bool preserve_local_ordering = false);
+
+    /*!
+     * Determine whether the patch boxes and processor assignments of a level
+     * match those recorded at the most recent redistribution.
+     */
+    bool patchConfigurationIsUnchanged(int level_number) const;
 
     /*!
      * Determine the number of local Lagrangian nodes on all MPI processes with
@@ -1002,6 +1139,33 @@ private:
      */
     static void computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_offset, unsigned int num_local_nodes);
 
+    /*!
+     * Recalibrate the workload coefficients using the time
+     * accumulated by the workload timers since the previous calibration, and
+     * log the predicted and measured load imbalance.
+     */
+    void calibrateWorkloadEstimates();
+
+    /*!
+     * Determine the total time accumulated by each category of workload timers
+     * on the current MPI process.
+     */
+    void getWorkloadTimes(double& marker_time, double& force_time, double& eul_time) const;
+
+    /*!
+     * Record the numbers of local nodes, springs, cells, and patches in the
+     * current configuration of the patch hierarchy for use in calibrating the
+     * workload estimates, and reset the reference times of the workload
+     * timers.
+     */
+    void sampleWorkloadCounts();
+
+    /*!
+     * Add the per-spring and per-patch contributions to the workload on the
+     * specified range of levels.
+     */
+    void addSpringAndPatchWorkload(int coarsest_ln, int finest_ln);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -1072,11 +1236,25 @@ private:
      * cell variable used to determine the workload for nonuniform load
      * balancing.
      */
-    double d_beta_work;
+    double d_beta_work, d_beta_spring, d_beta_patch;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_workload_var;
     int d_workload_idx;
     bool d_output_workload;
 
+    /*
+     * Settings and accumulated times used to calibrate the workload estimates
+     * from measured execution times.
+     */
+    bool d_use_measured_workload_estimates;
+    std::vector<std::string> d_workload_marker_timer_names, d_workload_force_timer_names,
+        d_workload_eul_timer_names;
+    double d_workload_marker_time, d_workload_force_time, d_workload_eul_time;
+    bool d_workload_counts_stale;
+    double d_workload_num_local_nodes, d_workload_num_local_springs, d_workload_num_local_cells,
+        d_workload_num_local_patches;
+    SpringCountCallbackFcnPtr d_spring_count_callback;
+    void* d_spring_count_callback_ctx;
+
     /*
      * SAMRAI::hier::Variable pointer and patch data descriptor indices for the
      * cell variable used to keep track of the count of the nodes in each cell
@@ -1092,6 +1270,16 @@ private:
     const std::string d_default_interp_kernel_fcn;
     const std::string d_default_spread_kernel_fcn;
 
+    /*
+     * Whether to use thread-parallel (colored) spreading.
+     */
+    bool d_use_threaded_spreading;
+
+    /*
+     * Whether to use the cell-sorted interaction kernels.
+     */
+    bool d_use_cell_sorted_kernels;
+
     /*
      * Whether to emit an error message if IB points "escape" from the computational
      * domain.
@@ -1213,6 +1401,14 @@ private:
      */
     std::vector<std::vector<int> > d_nonlocal_petsc_indices;
 
+    /*
+     * Whether to use incremental redistribution, along with the patch boxes and
+     * processor assignments of each level at the most recent redistribution.
+     */
+    bool d_use_incremental_data_redistribution;
+    std::vector<SAMRAI::hier::BoxArray<NDIM> > d_redistribution_patch_boxes;
+    std::vector<std::vector<int> > d_redistribution_patch_procs;
+
     //\}
 };
 } // namespace IBTK
@@ -89,6 +89,38 @@ namespace IBTK
  * to interpolate data from Eulerian grid patches onto Lagrangian meshes and to
  * spread values (\em not densities) from Lagrangian meshes to Eulerian grid
  * patches.
+ *
+ * When \a use_threaded_spreading is passed to spread(), the markers on each
+ * patch are binned into tiles whose width exceeds the kernel stencil size, and
+ * the tiles are assigned one of 2^NDIM colors so that the kernel footprints of
+ * markers in distinct tiles of the same color never overlap.  The colors are
+ * processed one after another, and the tiles within each color are spread
+ * concurrently using OpenMP threads without any atomic updates.
+ *
+ * \note The order in which values are accumulated into each grid cell by the
+ * threaded algorithm depends only on the marker ordering and on the tiling, so
+ * its results are bitwise identical for any number of threads (including one).
+ * They are \em not bitwise identical to those of the default (non-threaded)
+ * algorithm, from which they differ by floating-point roundoff.
+ *
+ * \note Threads are only used when the library is configured with
+ * --enable-openmp.  Otherwise, the colored tiles are processed serially.  The
+ * Fortran spreading kernels do not use SAVE, COMMON, or DATA statements, and
+ * all of their local variables are allocated on the stack when compiled with
+ * the OpenMP flags, so they may be called concurrently.
+ *
+ * When \a use_cell_sorted_kernels is passed to interpolate() or spread(),
+ * the IB_4, IB_4_W8, BSPLINE_4, and BSPLINE_6 kernel functions are evaluated
+ * by C++ kernels that process the markers ordered by the grid cell containing
+ * the lower corner of their stencils, compute the kernel weights for blocks of
+ * markers at a time, and use the stencil width as a compile-time constant so
+ * that the tensor-product loops are fully unrolled.  Other kernel functions
+ * always use the default implementations.
+ *
+ * \note The IB_4 and IB_4_W8 interpolation results are identical to those
+ * computed by the default implementation.  Because markers are visited in a
+ * different order, spreading results differ from those of the default
+ * implementation by roundoff.
  */
 class LEInteractor
 {
@@ -128,6 +160,12 @@ public:
      */
     static int getMinimumGhostWidth(const std::string& kernel_fcn);
 
+    /*!
+     * \brief Indicate whether a cell-sorted C++ implementation is available
+     * for the specified kernel function.
+     */
+    static bool hasCellSortedKernel(const std::string& kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -151,7 +189,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -176,7 +215,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -201,7 +241,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -226,7 +267,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -253,7 +295,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -280,7 +323,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -307,7 +351,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -334,7 +379,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -358,7 +404,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -382,7 +429,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -406,7 +454,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -430,7 +479,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -456,7 +506,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -482,7 +533,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -508,7 +560,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
@@ -534,7 +587,8 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
-                            const std::string& interp_fcn = "IB_4");
+                            const std::string& interp_fcn = "IB_4",
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -562,7 +616,9 @@ public:
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -590,7 +646,9 @@ public:
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -618,7 +676,9 @@ public:
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -646,7 +706,9 @@ public:
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -676,7 +738,9 @@ public:
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -706,7 +770,9 @@ public:
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -736,7 +802,9 @@ public:
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -766,7 +834,9 @@ public:
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -793,7 +863,9 @@ public:
                        int X_depth,
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -820,7 +892,9 @@ public:
                        int X_depth,
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -847,7 +921,9 @@ public:
                        int X_depth,
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -874,7 +950,9 @@ public:
                        int X_depth,
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -903,7 +981,9 @@ public:
                        int X_depth,
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -932,7 +1012,9 @@ public:
                        int X_depth,
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -961,7 +1043,9 @@ public:
                        int X_depth,
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -990,7 +1074,9 @@ public:
                        int X_depth,
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
 
 private:
     /*!
@@ -1045,7 +1131,8 @@ private:
                             const std::vector<int>& local_indices,
                             const std::vector<double>& periodic_shifts,
                             const std::string& interp_fcn,
-                            int axis = 0);
+                            int axis = 0,
+                            bool use_cell_sorted_kernels = false);
 
     /*!
      * Implementation of the IB spreading operation.
@@ -1065,7 +1152,46 @@ private:
                        const std::vector<int>& local_indices,
                        const std::vector<double>& periodic_shifts,
                        const std::string& spread_fcn,
-                       int axis = 0);
+                       int axis = 0,
+                       bool use_threaded_spreading = false,
+                       bool use_cell_sorted_kernels = false);
+
+    /*!
+     * Dispatch the IB spreading operation for a single batch of markers to
+     * the appropriate kernel implementation.
+     */
+    static void spreadKernel(double* q_data,
+                             const SAMRAI::hier::Box<NDIM>& q_data_box,
+                             const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                             int q_depth,
+                             const double* Q_data,
+                             int Q_depth,
+                             const double* X_data,
+                             const double* x_lower,
+                             const double* x_upper,
+                             const double* dx,
+                             const std::vector<int>& local_indices,
+                             const std::vector<double>& periodic_shifts,
+                             const std::string& spread_fcn,
+                             int axis,
+                             bool use_cell_sorted_kernels);
+
+    /*!
+     * Partition the markers into conflict-free colored batches for
+     * thread-parallel spreading.
+     *
+     * Upon return, batch_local_indices[c] and batch_periodic_shifts[c] contain
+     * the batches (tiles) of color c.  Markers retain their relative ordering
+     * within each batch.
+     */
+    static void buildColoredSpreadBatches(std::vector<std::vector<std::vector<int> > >& batch_local_indices,
+                                          std::vector<std::vector<std::vector<double> > >& batch_periodic_shifts,
+                                          const double* X_data,
+                                          const double* x_lower,
+                                          const double* dx,
+                                          const std::vector<int>& local_indices,
+                                          const std::vector<double>& periodic_shifts,
+                                          int stencil_size);
 
     /*!
      * \brief Compute the local PETSc indices located within the provided box
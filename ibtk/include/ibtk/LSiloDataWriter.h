@@ -71,6 +71,17 @@ namespace IBTK
  *
  * For more information about Silo, see the Silo manual <A
  * HREF="http://www.llnl.gov/bdiv/meshtv/manuals/silo.pdf">here</A>.
+ *
+ * By default, each MPI process writes its local data to a separate Silo file.
+ * On large numbers of processes, the number of files generated per time step
+ * may be reduced by grouping processes via setNumberOfProcessesPerFile(), or,
+ * for the data writer created by AppInitializer, via the
+ * <TT>silo_number_procs_per_file</TT> entry of the <TT>Main</TT> input
+ * database.
+ * Processes within a group take turns appending their data to a shared file,
+ * with each process writing into its own directory within that file, in a
+ * manner analogous to the poor man's parallel I/O (PMPIO) approach employed by
+ * Silo.
  */
 class LSiloDataWriter : public SAMRAI::tbox::Serializable
 {
@@ -111,6 +122,20 @@ public:
 
     //\}
 
+    /*!
+     * \brief Set the number of MPI processes that write to each Silo data file.
+     *
+     * Processes are grouped by rank, and the processes in each group write
+     * their data sequentially to a single file.  The default value of 1
+     * results in one file per MPI process.
+     */
+    void setNumberOfProcessesPerFile(int num_procs_per_file);
+
+    /*!
+     * \brief Get the number of MPI processes that write to each Silo data file.
+     */
+    int getNumberOfProcessesPerFile() const;
+
     /*!
      * \brief Register or update a range of Lagrangian indices that are to be
      * visualized as a cloud of marker particles.
@@ -274,6 +299,11 @@ private:
      */
     std::string d_dump_directory_name;
 
+    /*
+     * The number of MPI processes that share each Silo data file.
+     */
+    int d_num_procs_per_file;
+
     /*
      * Time step number (passed in by user).
      */
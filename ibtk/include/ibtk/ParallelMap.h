@@ -111,6 +111,10 @@ public:
 
     /*!
      * \brief Communicate data to (re-)initialize the map.
+     *
+     * \note This method is collective.  The pending additions and removals
+     * from all processes are exchanged using a fixed number of all-gather
+     * operations, independent of the number of processes.
      */
     void communicateData();
 
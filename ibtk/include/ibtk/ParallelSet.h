@@ -105,6 +105,10 @@ public:
 
     /*!
      * \brief Communicate data to (re-)initialize the set.
+     *
+     * \note This method is collective.  The key counts are exchanged with one
+     * all-gather, followed by one all-gather for the added keys and one for the
+     * removed keys.
      */
     void communicateData();
 
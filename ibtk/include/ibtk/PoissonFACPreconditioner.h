@@ -93,6 +93,14 @@ public:
      */
     void setPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
 
+    /*!
+     * \brief Reset the coefficients of the Laplace operator of an initialized
+     * solver without reinitializing its solver state.
+     *
+     * \see PoissonSolver::updatePoissonSpecifications()
+     */
+    bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
+
     /*!
      * \brief Set the SAMRAI::solv::RobinBcCoefStrategy object used to specify
      * physical boundary conditions.
@@ -133,6 +133,18 @@ public:
      */
     virtual void setPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
 
+    /*!
+     * \brief Reset the coefficients of the Laplace operator without
+     * reinitializing the operator state.
+     *
+     * \return true if the operator state has been updated in place, or false if
+     * the operator state must be reinitialized before it is used.
+     *
+     * \note The default implementation calls setPoissonSpecifications() and
+     * returns false.
+     */
+    virtual bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
+
     /*!
      * \brief Set the SAMRAI::solv::RobinBcCoefStrategy object used to specify
      * physical boundary conditions.
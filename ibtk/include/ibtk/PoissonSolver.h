@@ -75,6 +75,22 @@ public:
      */
     virtual void setPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
 
+    /*!
+     * \brief Reset the coefficients of the Laplace operator of an initialized
+     * solver without reinitializing its solver state.
+     *
+     * This is intended for use when only the values of the coefficients have
+     * changed (e.g., because the time step size has changed), and the grid
+     * hierarchy and boundary conditions remain the same.
+     *
+     * \return true if the solver state has been updated in place, or false if
+     * the solver must be reinitialized before it is used.
+     *
+     * \note The default implementation calls setPoissonSpecifications() and
+     * returns false.
+     */
+    virtual bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
+
     /*!
      * \brief Set the SAMRAI::solv::RobinBcCoefStrategy object used to specify
      * physical boundary conditions.
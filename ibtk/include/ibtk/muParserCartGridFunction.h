@@ -40,7 +40,9 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
 #include "CartesianGridGeometry.h"
+#include "IntVector.h"
 #include "PatchLevel.h"
 #include "boost/array.hpp"
 #include "ibtk/CartGridFunction.h"
@@ -55,6 +57,8 @@ namespace hier
 template <int DIM>
 class Patch;
 template <int DIM>
+class PatchHierarchy;
+template <int DIM>
 class Variable;
 } // namespace hier
 namespace tbox
@@ -72,6 +76,15 @@ namespace IBTK
  * class CartGridFunction that allows for the run-time specification of
  * (possibly spatially- and temporally-varying) functions which are used to set
  * double precision values on standard SAMRAI SAMRAI::hier::PatchData objects.
+ *
+ * The functions are evaluated at all of the points of a patch with a single
+ * call to the parser's bulk evaluation routine.  The values of functions that
+ * do not depend on time are cached for each patch and reused until the patch
+ * configuration changes.  The cached values of a patch level are discarded
+ * when the function is next evaluated on a different patch level object with
+ * the same level number, e.g. after regridding, and the cached values of levels
+ * that are no longer in the patch hierarchy are discarded by
+ * setDataOnPatchHierarchy().
  */
 class muParserCartGridFunction : public CartGridFunction
 {
@@ -99,6 +112,21 @@ public:
      */
     bool isTimeDependent() const;
 
+    /*!
+     * \brief Evaluate the function on the patch interiors on the specified
+     * levels of the patch hierarchy.
+     *
+     * Cached function values for levels finer than the finest level of the
+     * patch hierarchy are discarded before the function is evaluated.
+     */
+    void setDataOnPatchHierarchy(int data_idx,
+                                 SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
+                                 SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                 double data_time,
+                                 bool initial_time = false,
+                                 int coarsest_ln = -1,
+                                 int finest_ln = -1);
+
     /*!
      * \brief Virtual function to evaluate the function on the patch interior.
      */
@@ -141,6 +169,40 @@ private:
      */
     muParserCartGridFunction& operator=(const muParserCartGridFunction& that);
 
+    /*!
+     * \brief Ensure that the time and position variables can hold at least the
+     * specified number of values.
+     */
+    void resizeParserVariables(int size);
+
+    /*!
+     * \brief Discard the cached function values of the specified level number
+     * if they were computed on a patch level object other than \a level.
+     */
+    void resetCachedValues(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level);
+
+    /*!
+     * \brief Discard the cached function values of all levels finer than the
+     * specified level number.
+     */
+    void pruneCachedValues(int finest_ln);
+
+    /*!
+     * \brief Evaluate the specified function at the points of the specified
+     * index box.
+     *
+     * Points are located at the lower corners of the cells indexed by the box,
+     * offset by half of a grid cell along the axes for which \a
+     * cell_centered_axes is nonzero.  The values are returned in the order in
+     * which SAMRAI::hier::Box::Iterator visits the indices of the box.
+     */
+    const std::vector<double>& getFunctionValues(int function_depth,
+                                                 int centering,
+                                                 const SAMRAI::hier::Box<NDIM>& box,
+                                                 const SAMRAI::hier::IntVector<NDIM>& cell_centered_axes,
+                                                 SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                                 double data_time);
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -164,10 +226,47 @@ private:
     std::vector<mu::Parser> d_parsers;
 
     /*!
-     * Time and position variables.
+     * Time and position variables.  Each variable is an array, so that the
+     * functions may be evaluated at many points with a single call to the
+     * parser.
+     */
+    std::vector<double> d_parser_time;
+    boost::array<std::vector<double>, NDIM> d_parser_posn;
+
+    /*!
+     * Whether each function depends on time.
+     */
+    std::vector<bool> d_parser_is_time_dependent;
+
+    /*!
+     * Cached values of a time-independent function, along with the index box
+     * and the physical extents of the patch for which they were computed.
+     */
+    struct CachedValues
+    {
+        SAMRAI::hier::Box<NDIM> box;
+        boost::array<double, 2 * NDIM> patch_extents;
+        std::vector<double> values;
+    };
+
+    /*!
+     * Cached values of the time-independent functions, indexed by the patch
+     * level number, the patch number, the function index, and the data
+     * centering.
+     */
+    std::map<boost::array<int, 4>, CachedValues> d_cached_values;
+
+    /*!
+     * The patch level objects on which the cached values were computed,
+     * indexed by level number.  These pointers are used only to detect changes
+     * to the patch hierarchy and are never dereferenced.
+     */
+    std::vector<const SAMRAI::hier::PatchLevel<NDIM>*> d_cached_levels;
+
+    /*!
+     * Scratch storage for the values of time-dependent functions.
      */
-    double d_parser_time;
-    Point d_parser_posn;
+    std::vector<double> d_values;
 };
 } // namespace IBTK
 
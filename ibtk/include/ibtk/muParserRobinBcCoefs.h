@@ -211,6 +211,13 @@ private:
     std::vector<mu::Parser> d_bcoef_parsers;
     std::vector<mu::Parser> d_gcoef_parsers;
 
+    /*!
+     * Whether each function depends on neither position nor time.
+     */
+    std::vector<bool> d_acoef_is_constant;
+    std::vector<bool> d_bcoef_is_constant;
+    std::vector<bool> d_gcoef_is_constant;
+
     /*!
      * Time and position variables.
      */
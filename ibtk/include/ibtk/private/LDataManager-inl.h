@@ -62,6 +62,30 @@ LDataManager::getDefaultSpreadKernelFunction() const
     return d_default_spread_kernel_fcn;
 } // getDefaultSpreadKernelFunction
 
+inline bool
+LDataManager::getUseThreadedSpreading() const
+{
+    return d_use_threaded_spreading;
+} // getUseThreadedSpreading
+
+inline bool
+LDataManager::getUseCellSortedKernels() const
+{
+    return d_use_cell_sorted_kernels;
+} // getUseCellSortedKernels
+
+inline bool
+LDataManager::getUseMeasuredWorkloadEstimates() const
+{
+    return d_use_measured_workload_estimates;
+} // getUseMeasuredWorkloadEstimates
+
+inline bool
+LDataManager::getUseIncrementalDataRedistribution() const
+{
+    return d_use_incremental_data_redistribution;
+} // getUseIncrementalDataRedistribution
+
 inline bool
 LDataManager::levelContainsLagrangianData(const int level_number) const
 {
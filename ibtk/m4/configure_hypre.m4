@@ -11,6 +11,17 @@ PACKAGE_SETUP_ENVIRONMENT
 if test `grep -c HYPRE "${PETSC_DIR}/${PETSC_ARCH}/lib/petsc/conf/petscvariables"` != 0 ; then
   AC_MSG_NOTICE([PETSc appears to provide hypre; using PETSc hypre library])
   PETSC_BUNDLES_HYPRE=yes
+
+  # IBTK requires the HYPRE_StructVectorSetBoxValues2() family of functions,
+  # which were introduced in hypre 2.10.0.  PETSc has not yet been configured,
+  # so only check that the PETSc-provided headers declare these functions.
+  HYPRE_save_CPPFLAGS=$CPPFLAGS
+  HYPRE_PETSC_CC_INCLUDES=`grep "PETSC_CC_INCLUDES =" $PETSC_DIR/$PETSC_ARCH/lib/petsc/conf/petscvariables | sed -e 's/.*=//' -e 's/^@<:@ \t@:>@*//'`
+  CPPFLAGS="$HYPRE_PETSC_CC_INCLUDES $CPPFLAGS"
+  AC_CHECK_DECL([HYPRE_StructVectorSetBoxValues2],,
+    [AC_MSG_ERROR([the version of hypre provided by PETSc does not provide HYPRE_StructVectorSetBoxValues2(); hypre 2.10.0 or later is required])],
+    [#include <HYPRE_struct_ls.h>])
+  CPPFLAGS=$HYPRE_save_CPPFLAGS
 else
   PETSC_BUNDLES_HYPRE=no
 
@@ -39,6 +50,14 @@ else
     AC_MSG_ERROR([could not find working libHYPRE])
   fi
 
+  # IBTK requires the HYPRE_StructVectorSetBoxValues2() family of functions,
+  # which were introduced in hypre 2.10.0.
+  HYPRE_save_LIBS=$LIBS
+  LIBS="$LIBHYPRE $LIBS"
+  AC_CHECK_FUNC([HYPRE_StructVectorSetBoxValues2],,
+    [AC_MSG_ERROR([libHYPRE does not provide HYPRE_StructVectorSetBoxValues2(); hypre 2.10.0 or later is required])])
+  LIBS=$HYPRE_save_LIBS
+
   PACKAGE_CPPFLAGS_PREPEND($HYPRE_CPPFLAGS)
   PACKAGE_LDFLAGS_PREPEND($HYPRE_LDFLAGS)
   PACKAGE_LIBS_PREPEND("$LIBHYPRE")
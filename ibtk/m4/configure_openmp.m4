@@ -0,0 +1,77 @@
+# -------------------------------------------------------------
+# -------------------------------------------------------------
+AC_DEFUN([CONFIGURE_OPENMP],[
+echo
+echo "==================================="
+echo "Configuring optional package OpenMP"
+echo "==================================="
+
+AC_ARG_ENABLE([openmp],
+  AS_HELP_STRING([--enable-openmp],[enable OpenMP threading in IBAMR and IBTK @<:@default=no@:>@]),
+  [case "$enableval" in
+     yes)  USING_OPENMP=yes ;;
+     no)   USING_OPENMP=no ;;
+     *)    AC_MSG_ERROR([--enable-openmp=$enableval is invalid; choices are "yes" and "no"]) ;;
+   esac],[USING_OPENMP=no])
+
+if test "$USING_OPENMP" = yes ; then
+  # The C++ compiler must define _OPENMP, which is used to guard all threaded
+  # code paths.
+  AC_LANG_PUSH([C++])
+  AC_MSG_CHECKING([for C++ compiler flag to enable OpenMP])
+  OPENMP_CXXFLAGS=none
+  OPENMP_save_CXXFLAGS=$CXXFLAGS
+  for flag in -fopenmp -qopenmp -openmp -mp -xopenmp ; do
+    CXXFLAGS="$OPENMP_save_CXXFLAGS $flag"
+    AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#if !defined(_OPENMP)
+#error _OPENMP is not defined
+#endif
+#include <omp.h>
+]], [[
+    return omp_get_max_threads() > 0 ? 0 : 1;
+]])],[OPENMP_CXXFLAGS=$flag])
+    if test "$OPENMP_CXXFLAGS" != none ; then
+      break
+    fi
+  done
+  CXXFLAGS=$OPENMP_save_CXXFLAGS
+  AC_MSG_RESULT([$OPENMP_CXXFLAGS])
+  AC_LANG_POP([C++])
+  if test "$OPENMP_CXXFLAGS" = none ; then
+    AC_MSG_ERROR([--enable-openmp was specified, but the C++ compiler does not support OpenMP])
+  fi
+
+  # The Fortran kernels called from threaded regions must also be compiled with
+  # OpenMP support so that all local variables are allocated on the stack.
+  AC_LANG_PUSH([Fortran])
+  AC_MSG_CHECKING([for Fortran compiler flag to enable OpenMP])
+  OPENMP_FCFLAGS=none
+  OPENMP_save_FCFLAGS=$FCFLAGS
+  for flag in -fopenmp -qopenmp -openmp -mp -xopenmp ; do
+    FCFLAGS="$OPENMP_save_FCFLAGS $flag"
+    AC_LINK_IFELSE([AC_LANG_PROGRAM([],[[
+      integer omp_get_max_threads
+      external omp_get_max_threads
+      if (omp_get_max_threads() .lt. 1) stop 1]])],[OPENMP_FCFLAGS=$flag])
+    if test "$OPENMP_FCFLAGS" != none ; then
+      break
+    fi
+  done
+  FCFLAGS=$OPENMP_save_FCFLAGS
+  AC_MSG_RESULT([$OPENMP_FCFLAGS])
+  AC_LANG_POP([Fortran])
+  if test "$OPENMP_FCFLAGS" = none ; then
+    AC_MSG_ERROR([--enable-openmp was specified, but the Fortran compiler does not support OpenMP])
+  fi
+
+  CXXFLAGS="$CXXFLAGS $OPENMP_CXXFLAGS"
+  FCFLAGS="$FCFLAGS $OPENMP_FCFLAGS"
+  FFLAGS="$FFLAGS $OPENMP_FCFLAGS"
+  AC_MSG_NOTICE([OpenMP threading is enabled])
+else
+  AC_MSG_NOTICE([OpenMP threading is disabled])
+fi
+AC_SUBST(OPENMP_CXXFLAGS)
+AC_SUBST(OPENMP_FCFLAGS)
+])
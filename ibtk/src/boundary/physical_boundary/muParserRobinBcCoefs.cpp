@@ -89,6 +89,9 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
       d_acoef_parsers(2 * NDIM),
       d_bcoef_parsers(2 * NDIM),
       d_gcoef_parsers(2 * NDIM),
+      d_acoef_is_constant(2 * NDIM, false),
+      d_bcoef_is_constant(2 * NDIM, false),
+      d_gcoef_is_constant(2 * NDIM, false),
       d_parser_time(new double),
       d_parser_posn(new Point)
 {
@@ -333,6 +336,33 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
             (*cit)->DefineVar("x_" + postfix, &d_parser_posn->data()[d]);
         }
     }
+
+    // Determine which functions depend on neither position nor time.  These
+    // functions are evaluated once per boundary box instead of once per point.
+    for (int d = 0; d < 2 * NDIM; ++d)
+    {
+        try
+        {
+            d_acoef_is_constant[d] = d_acoef_parsers[d].GetUsedVar().empty();
+            d_bcoef_is_constant[d] = d_bcoef_parsers[d].GetUsedVar().empty();
+            d_gcoef_is_constant[d] = d_gcoef_parsers[d].GetUsedVar().empty();
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                       << "  error: "
+                       << e.GetMsg()
+                       << "\n"
+                       << "  in:    "
+                       << e.GetExpr()
+                       << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
+        }
+    }
     return;
 } // muParserRobinBcCoefs
 
@@ -374,42 +404,57 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
     const mu::Parser& acoef_parser = d_acoef_parsers[location_index];
     const mu::Parser& bcoef_parser = d_bcoef_parsers[location_index];
     const mu::Parser& gcoef_parser = d_gcoef_parsers[location_index];
+    const bool acoef_is_constant = d_acoef_is_constant[location_index];
+    const bool bcoef_is_constant = d_bcoef_is_constant[location_index];
+    const bool gcoef_is_constant = d_gcoef_is_constant[location_index];
     *d_parser_time = fill_time;
-    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+    try
     {
-        const Index<NDIM>& i = b();
-        for (unsigned int d = 0; d < NDIM; ++d)
+        // Set the coefficients that do not vary along the boundary.
+        if (acoef_data && acoef_is_constant) acoef_data->fill(acoef_parser.Eval(), bc_coef_box);
+        if (bcoef_data && bcoef_is_constant) bcoef_data->fill(bcoef_parser.Eval(), bc_coef_box);
+        if (gcoef_data && gcoef_is_constant) gcoef_data->fill(gcoef_parser.Eval(), bc_coef_box);
+
+        // Evaluate the remaining coefficients point by point.
+        const bool set_acoef = acoef_data && !acoef_is_constant;
+        const bool set_bcoef = bcoef_data && !bcoef_is_constant;
+        const bool set_gcoef = gcoef_data && !gcoef_is_constant;
+        if (set_acoef || set_bcoef || set_gcoef)
         {
-            if (d != bdry_normal_axis)
-            {
-                (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-            }
-            else
+            for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
             {
-                (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                const Index<NDIM>& i = b();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    if (d != bdry_normal_axis)
+                    {
+                        (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                    }
+                    else
+                    {
+                        (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                    }
+                }
+                if (set_acoef) (*acoef_data)(i, 0) = acoef_parser.Eval();
+                if (set_bcoef) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
+                if (set_gcoef) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
             }
         }
-        try
-        {
-            if (acoef_data) (*acoef_data)(i, 0) = acoef_parser.Eval();
-            if (bcoef_data) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
-            if (gcoef_data) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
-        }
-        catch (mu::ParserError& e)
-        {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  error: "
-                       << e.GetMsg()
-                       << "\n"
-                       << "  in:    "
-                       << e.GetExpr()
-                       << "\n");
-        }
-        catch (...)
-        {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  unrecognized exception generated by muParser library.\n");
-        }
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                   << "  error: "
+                   << e.GetMsg()
+                   << "\n"
+                   << "  in:    "
+                   << e.GetExpr()
+                   << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
     }
     return;
 } // setBcCoefs
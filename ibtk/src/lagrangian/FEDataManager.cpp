@@ -66,6 +66,8 @@
 #include "MultiblockDataTranslator.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "ProcessorMapping.h"
@@ -253,6 +255,33 @@ get_elem_hmax(Elem* const elem, const boost::multi_array<double, 2>& X_node)
     }
     return hmax;
 } // get_elem_hmax
+
+inline Order
+get_adaptive_quadrature_order(const QuadratureType type,
+                              Elem* const elem,
+                              const boost::multi_array<double, 2>& X_node,
+                              const double point_density,
+                              const double dx_min)
+{
+    const double hmax = get_elem_hmax(elem, X_node);
+    const int min_pts = elem->default_order() == FIRST ? 2 : 3;
+    const int npts = std::max(min_pts, static_cast<int>(std::ceil(point_density * hmax / dx_min)));
+    Order order = CONSTANT;
+    switch (type)
+    {
+    case QGAUSS:
+        order = static_cast<Order>(std::min(2 * npts - 1, static_cast<int>(FORTYTHIRD)));
+        break;
+    case QGRID:
+        order = static_cast<Order>(npts);
+        break;
+    default:
+        TBOX_ERROR("FEDataManager::updateQuadratureRule():\n"
+                   << "  adaptive quadrature rules are available only for quad_type = QGAUSS "
+                      "or QGRID\n");
+    }
+    return order;
+} // get_adaptive_quadrature_order
 }
 
 const short int FEDataManager::ZERO_DISPLACEMENT_X_BDRY_ID = 0x100;
@@ -504,23 +533,18 @@ FEDataManager::spread(const int f_data_idx,
     TBOX_ASSERT(cc_data || sc_data);
 
     // Make a copy of the Eulerian data.
-    const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
+    const int f_copy_data_idx = getSpreadScratchDataIndex(f_data_idx);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(f_copy_data_idx);
+        if (!level->checkAllocated(f_copy_data_idx)) level->allocatePatchData(f_copy_data_idx);
     }
     Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
         HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
     f_data_ops->swapData(f_copy_data_idx, f_data_idx);
     f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
 
-    // Extract the mesh.
-    const MeshBase& mesh = d_es->get_mesh();
-    const unsigned int dim = mesh.mesh_dimension();
-    AutoPtr<QBase> qrule;
-
-    // Extract the FE systems and DOF maps, and setup the FE object.
+    // Extract the FE systems and DOF maps.
     System& F_system = d_es->get_system(system_name);
     System& X_system = d_es->get_system(COORDINATES_SYSTEM_NAME);
     const unsigned int n_vars = F_system.n_vars();
@@ -532,16 +556,6 @@ FEDataManager::spread(const int f_data_idx,
     for (unsigned i = 0; i < n_vars; ++i) TBOX_ASSERT(F_dof_map.variable_type(i) == F_fe_type);
     FEType X_fe_type = X_dof_map.variable_type(0);
     for (unsigned d = 0; d < NDIM; ++d) TBOX_ASSERT(X_dof_map.variable_type(d) == X_fe_type);
-    AutoPtr<FEBase> F_fe_autoptr(FEBase::build(dim, F_fe_type)), X_fe_autoptr(NULL);
-    if (F_fe_type != X_fe_type)
-    {
-        X_fe_autoptr = AutoPtr<FEBase>(FEBase::build(dim, X_fe_type));
-    }
-    FEBase* F_fe = F_fe_autoptr.get();
-    FEBase* X_fe = X_fe_autoptr.get() ? X_fe_autoptr.get() : F_fe_autoptr.get();
-    const std::vector<double>& JxW_F = F_fe->get_JxW();
-    const std::vector<std::vector<double> >& phi_F = F_fe->get_phi();
-    const std::vector<std::vector<double> >& phi_X = X_fe->get_phi();
 
     // Communicate any unsynchronized ghost data and extract the underlying
     // solution data.
@@ -565,7 +579,9 @@ FEDataManager::spread(const int f_data_idx,
     // element quadrature points, then spread those values onto the Eulerian
     // grid.
     boost::multi_array<double, 2> F_node, X_node;
-    std::vector<double> F_JxW_qp, X_qp;
+    std::vector<QBase*> patch_elem_qrules;
+    std::vector<double>& F_JxW_qp = d_F_qp_workspace;
+    std::vector<double>& X_qp = d_X_qp_workspace;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_number);
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
@@ -580,8 +596,9 @@ FEDataManager::spread(const int f_data_idx,
         const double* const patch_dx = patch_geom->getDx();
         const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
-        // Setup vectors to store the values of F_JxW and X at the quadrature
-        // points.
+        // Determine the quadrature rule for each element and setup vectors to
+        // store the values of F_JxW and X at the quadrature points.
+        patch_elem_qrules.resize(num_active_patch_elems);
         unsigned int n_qp_patch = 0;
         for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
         {
@@ -591,12 +608,14 @@ FEDataManager::spread(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateSpreadQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
-            if (qrule_needs_reinit)
-            {
-                qrule->init(elem->type(), elem->p_level());
-            }
-            n_qp_patch += qrule->n_points();
+            patch_elem_qrules[e_idx] = getCachedQuadratureRule(spread_spec.quad_type,
+                                                               spread_spec.quad_order,
+                                                               spread_spec.use_adaptive_quadrature,
+                                                               spread_spec.point_density,
+                                                               elem,
+                                                               X_node,
+                                                               patch_dx_min);
+            n_qp_patch += patch_elem_qrules[e_idx]->n_points();
         }
         if (!n_qp_patch) continue;
         F_JxW_qp.resize(n_vars * n_qp_patch);
@@ -604,7 +623,6 @@ FEDataManager::spread(const int f_data_idx,
 
         // Loop over the elements and compute the values to be spread and the
         // positions of the quadrature points.
-        qrule.reset();
         unsigned int qp_offset = 0;
         for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
         {
@@ -619,20 +637,19 @@ FEDataManager::spread(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateSpreadQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
-            if (qrule_needs_reinit)
-            {
-                // NOTE: Because we are only using the shape function values for
-                // the FE object associated with X, we only need to reinitialize
-                // X_fe whenever the quadrature rule changes.  In particular,
-                // notice that the shape function values depend only on the
-                // element type and quadrature rule, not on the element
-                // geometry.
-                F_fe->attach_quadrature_rule(qrule.get());
-                X_fe->attach_quadrature_rule(qrule.get());
-                if (X_fe != F_fe) X_fe->reinit(elem);
-            }
+
+            // NOTE: Because we are only using the shape function values for the
+            // FE object associated with X, we do not need to reinitialize X_fe
+            // for each element.  The shape function values depend only on the
+            // element type and quadrature rule, not on the element geometry,
+            // and they are computed when the cached FE object is built.
+            QBase* const qrule = patch_elem_qrules[e_idx];
+            FEBase* const F_fe = getCachedFE(F_fe_type, qrule, elem);
+            FEBase* const X_fe = (F_fe_type == X_fe_type ? F_fe : getCachedFE(X_fe_type, qrule, elem));
             F_fe->reinit(elem);
+            const std::vector<double>& JxW_F = F_fe->get_JxW();
+            const std::vector<std::vector<double> >& phi_F = F_fe->get_phi();
+            const std::vector<std::vector<double> >& phi_X = X_fe->get_phi();
             const unsigned int n_node = elem->n_nodes();
             const unsigned int n_qp = qrule->n_points();
             double* F_begin = &F_JxW_qp[n_vars * qp_offset];
@@ -667,12 +684,30 @@ FEDataManager::spread(const int f_data_idx,
         if (cc_data)
         {
             Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-            LEInteractor::spread(f_cc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
+            LEInteractor::spread(f_cc_data,
+                                 F_JxW_qp,
+                                 n_vars,
+                                 X_qp,
+                                 NDIM,
+                                 patch,
+                                 spread_box,
+                                 spread_spec.kernel_fcn,
+                                 spread_spec.use_threaded_spreading,
+                                 spread_spec.use_cell_sorted_kernels);
         }
         if (sc_data)
         {
             Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-            LEInteractor::spread(f_sc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
+            LEInteractor::spread(f_sc_data,
+                                 F_JxW_qp,
+                                 n_vars,
+                                 X_qp,
+                                 NDIM,
+                                 patch,
+                                 spread_box,
+                                 spread_spec.kernel_fcn,
+                                 spread_spec.use_threaded_spreading,
+                                 spread_spec.use_cell_sorted_kernels);
         }
         if (f_phys_bdry_op)
         {
@@ -684,12 +719,6 @@ FEDataManager::spread(const int f_data_idx,
     // Accumulate data.
     f_data_ops->swapData(f_copy_data_idx, f_data_idx);
     f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(f_copy_data_idx);
-    }
-    var_db->removePatchDataIndex(f_copy_data_idx);
 
     VecRestoreArray(F_local_vec, &F_local_soln);
     VecGhostRestoreLocalForm(F_global_vec, &F_local_vec);
@@ -953,12 +982,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(cc_data || sc_data);
 
-    // Extract the mesh.
-    const MeshBase& mesh = d_es->get_mesh();
-    const unsigned int dim = mesh.mesh_dimension();
-    AutoPtr<QBase> qrule;
-
-    // Extract the FE systems and DOF maps, and setup the FE object.
+    // Extract the FE systems and DOF maps.
     System& F_system = d_es->get_system(system_name);
     System& X_system = d_es->get_system(COORDINATES_SYSTEM_NAME);
     const unsigned int n_vars = F_system.n_vars();
@@ -970,16 +994,6 @@ FEDataManager::interpWeighted(const int f_data_idx,
     for (unsigned i = 0; i < n_vars; ++i) TBOX_ASSERT(F_dof_map.variable_type(i) == F_fe_type);
     FEType X_fe_type = X_dof_map.variable_type(0);
     for (unsigned d = 0; d < NDIM; ++d) TBOX_ASSERT(X_dof_map.variable_type(d) == X_fe_type);
-    AutoPtr<FEBase> F_fe_autoptr(FEBase::build(dim, F_fe_type)), X_fe_autoptr(NULL);
-    if (F_fe_type != X_fe_type)
-    {
-        X_fe_autoptr = AutoPtr<FEBase>(FEBase::build(dim, X_fe_type));
-    }
-    FEBase* F_fe = F_fe_autoptr.get();
-    FEBase* X_fe = X_fe_autoptr.get() ? X_fe_autoptr.get() : F_fe_autoptr.get();
-    const std::vector<double>& JxW_F = F_fe->get_JxW();
-    const std::vector<std::vector<double> >& phi_F = F_fe->get_phi();
-    const std::vector<std::vector<double> >& phi_X = X_fe->get_phi();
 
     // Communicate any unsynchronized ghost data and extract the underlying
     // solution data.
@@ -1002,7 +1016,9 @@ FEDataManager::interpWeighted(const int f_data_idx,
     F_vec.zero();
     std::vector<DenseVector<double> > F_rhs_e(n_vars);
     boost::multi_array<double, 2> X_node;
-    std::vector<double> F_qp, X_qp;
+    std::vector<QBase*> patch_elem_qrules;
+    std::vector<double>& F_qp = d_F_qp_workspace;
+    std::vector<double>& X_qp = d_X_qp_workspace;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_number);
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
@@ -1017,8 +1033,9 @@ FEDataManager::interpWeighted(const int f_data_idx,
         const double* const patch_dx = patch_geom->getDx();
         const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
-        // Setup vectors to store the values of F and X at the quadrature
-        // points.
+        // Determine the quadrature rule for each element and setup vectors to
+        // store the values of F and X at the quadrature points.
+        patch_elem_qrules.resize(num_active_patch_elems);
         unsigned int n_qp_patch = 0;
         for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
         {
@@ -1028,12 +1045,14 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
-            if (qrule_needs_reinit)
-            {
-                qrule->init(elem->type(), elem->p_level());
-            }
-            n_qp_patch += qrule->n_points();
+            patch_elem_qrules[e_idx] = getCachedQuadratureRule(interp_spec.quad_type,
+                                                               interp_spec.quad_order,
+                                                               interp_spec.use_adaptive_quadrature,
+                                                               interp_spec.point_density,
+                                                               elem,
+                                                               X_node,
+                                                               patch_dx_min);
+            n_qp_patch += patch_elem_qrules[e_idx]->n_points();
         }
         if (!n_qp_patch) continue;
         F_qp.resize(n_vars * n_qp_patch);
@@ -1041,7 +1060,6 @@ FEDataManager::interpWeighted(const int f_data_idx,
         std::fill(F_qp.begin(), F_qp.end(), 0.0);
 
         // Loop over the elements and compute the positions of the quadrature points.
-        qrule.reset();
         unsigned int qp_offset = 0;
         for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
         {
@@ -1051,18 +1069,15 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
-            if (qrule_needs_reinit)
-            {
-                // NOTE: Because we are only using the shape function values for
-                // the FE object associated with X, we only need to reinitialize
-                // X_fe whenever the quadrature rule changes.  In particular,
-                // notice that the shape function values depend only on the
-                // element type and quadrature rule, not on the element
-                // geometry.
-                X_fe->attach_quadrature_rule(qrule.get());
-                X_fe->reinit(elem);
-            }
+
+            // NOTE: Because we are only using the shape function values for the
+            // FE object associated with X, we do not need to reinitialize X_fe
+            // for each element.  The shape function values depend only on the
+            // element type and quadrature rule, not on the element geometry,
+            // and they are computed when the cached FE object is built.
+            QBase* const qrule = patch_elem_qrules[e_idx];
+            FEBase* const X_fe = getCachedFE(X_fe_type, qrule, elem);
+            const std::vector<std::vector<double> >& phi_X = X_fe->get_phi();
             const unsigned int n_node = elem->n_nodes();
             const unsigned int n_qp = qrule->n_points();
             double* X_begin = &X_qp[NDIM * qp_offset];
@@ -1091,16 +1106,31 @@ FEDataManager::interpWeighted(const int f_data_idx,
         if (cc_data)
         {
             Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-            LEInteractor::interpolate(F_qp, n_vars, X_qp, NDIM, f_cc_data, patch, interp_box, interp_spec.kernel_fcn);
+            LEInteractor::interpolate(F_qp,
+                                      n_vars,
+                                      X_qp,
+                                      NDIM,
+                                      f_cc_data,
+                                      patch,
+                                      interp_box,
+                                      interp_spec.kernel_fcn,
+                                      interp_spec.use_cell_sorted_kernels);
         }
         if (sc_data)
         {
             Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-            LEInteractor::interpolate(F_qp, n_vars, X_qp, NDIM, f_sc_data, patch, interp_box, interp_spec.kernel_fcn);
+            LEInteractor::interpolate(F_qp,
+                                      n_vars,
+                                      X_qp,
+                                      NDIM,
+                                      f_sc_data,
+                                      patch,
+                                      interp_box,
+                                      interp_spec.kernel_fcn,
+                                      interp_spec.use_cell_sorted_kernels);
         }
 
         // Loop over the elements and accumulate the right-hand-side values.
-        qrule.reset();
         qp_offset = 0;
         for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
         {
@@ -1110,25 +1140,11 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 F_dof_map.dof_indices(elem, F_dof_indices[i], i);
                 F_rhs_e[i].resize(static_cast<int>(F_dof_indices[i].size()));
             }
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X_dof_map.dof_indices(elem, X_dof_indices[d], d);
-            }
-            get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
-            if (qrule_needs_reinit)
-            {
-                // NOTE: Because we are only using the shape function values for
-                // the FE object associated with X, we only need to reinitialize
-                // X_fe whenever the quadrature rule changes.  In particular,
-                // notice that the shape function values depend only on the
-                // element type and quadrature rule, not on the element
-                // geometry.
-                F_fe->attach_quadrature_rule(qrule.get());
-                X_fe->attach_quadrature_rule(qrule.get());
-                if (X_fe != F_fe) X_fe->reinit(elem);
-            }
+            QBase* const qrule = patch_elem_qrules[e_idx];
+            FEBase* const F_fe = getCachedFE(F_fe_type, qrule, elem);
             F_fe->reinit(elem);
+            const std::vector<double>& JxW_F = F_fe->get_JxW();
+            const std::vector<std::vector<double> >& phi_F = F_fe->get_phi();
             const unsigned int n_qp = qrule->n_points();
             const size_t n_basis = F_dof_indices[0].size();
             for (unsigned int qp = 0; qp < n_qp; ++qp)
@@ -1757,22 +1773,7 @@ FEDataManager::updateQuadratureRule(AutoPtr<QBase>& qrule,
     unsigned int dim = elem->dim();
     if (use_adaptive_quadrature)
     {
-        const double hmax = get_elem_hmax(elem, X_node);
-        const int min_pts = elem->default_order() == FIRST ? 2 : 3;
-        const int npts = std::max(min_pts, static_cast<int>(std::ceil(point_density * hmax / dx_min)));
-        switch (type)
-        {
-        case QGAUSS:
-            order = static_cast<Order>(std::min(2 * npts - 1, static_cast<int>(FORTYTHIRD)));
-            break;
-        case QGRID:
-            order = static_cast<Order>(npts);
-            break;
-        default:
-            TBOX_ERROR("FEDataManager::updateQuadratureRule():\n"
-                       << "  adaptive quadrature rules are available only for quad_type = QGAUSS "
-                          "or QGRID\n");
-        }
+        order = get_adaptive_quadrature_order(type, elem, X_node, point_density, dx_min);
     }
     bool qrule_needs_reinit = false;
     if (!qrule.get() || qrule->type() != type || qrule->get_dim() != dim || qrule->get_order() != order)
@@ -1872,6 +1873,10 @@ FEDataManager::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM
         TBOX_ASSERT(hierarchy->getPatchLevel(ln));
     }
 
+    // Free the spreading scratch data, which is reallocated as needed on the
+    // new patch levels.
+    clearSpreadScratchData();
+
     // Reset the patch hierarchy and levels.
     setPatchHierarchy(hierarchy);
     setPatchLevels(0, d_hierarchy->getFinestLevelNumber());
@@ -2063,7 +2068,12 @@ FEDataManager::FEDataManager(const std::string& object_name,
       d_L2_proj_matrix(),
       d_L2_proj_matrix_diag(),
       d_L2_proj_quad_type(),
-      d_L2_proj_quad_order()
+      d_L2_proj_quad_order(),
+      d_spread_scratch_idxs(),
+      d_F_qp_workspace(),
+      d_X_qp_workspace(),
+      d_qrule_cache(),
+      d_fe_cache()
 {
     TBOX_ASSERT(!object_name.empty());
 
@@ -2115,6 +2125,7 @@ FEDataManager::FEDataManager(const std::string& object_name,
 
 FEDataManager::~FEDataManager()
 {
+    clearSpreadScratchData();
     for (std::map<std::string, NumericVector<double>*>::iterator it = d_system_ghost_vec.begin();
          it != d_system_ghost_vec.end();
          ++it)
@@ -2139,11 +2150,116 @@ FEDataManager::~FEDataManager()
     {
         delete it->second;
     }
+    for (std::map<std::pair<FEType, QBase*>, FEBase*>::iterator it = d_fe_cache.begin(); it != d_fe_cache.end(); ++it)
+    {
+        delete it->second;
+    }
+    for (std::map<QuadratureKey, QBase*>::iterator it = d_qrule_cache.begin(); it != d_qrule_cache.end(); ++it)
+    {
+        delete it->second;
+    }
     return;
 } // ~FEDataManager
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+QBase*
+FEDataManager::getCachedQuadratureRule(const QuadratureType quad_type,
+                                       Order quad_order,
+                                       const bool use_adaptive_quadrature,
+                                       const double point_density,
+                                       Elem* const elem,
+                                       const boost::multi_array<double, 2>& X_node,
+                                       const double dx_min)
+{
+    if (use_adaptive_quadrature)
+    {
+        quad_order = get_adaptive_quadrature_order(quad_type, elem, X_node, point_density, dx_min);
+    }
+    QuadratureKey key;
+    key[0] = elem->type();
+    key[1] = quad_type;
+    key[2] = quad_order;
+    key[3] = elem->p_level();
+    std::map<QuadratureKey, QBase*>::iterator it = d_qrule_cache.find(key);
+    if (it != d_qrule_cache.end()) return it->second;
+
+    // Build and initialize a new quadrature rule.
+    const unsigned int dim = elem->dim();
+    AutoPtr<QBase> qrule =
+        (quad_type == QGRID ? AutoPtr<QBase>(new QGrid(dim, quad_order)) : QBase::build(quad_type, dim, quad_order));
+    qrule->init(elem->type(), elem->p_level());
+    return d_qrule_cache[key] = qrule.release();
+} // getCachedQuadratureRule
+
+FEBase*
+FEDataManager::getCachedFE(const FEType& fe_type, QBase* const qrule, Elem* const elem)
+{
+    const std::pair<FEType, QBase*> key(fe_type, qrule);
+    std::map<std::pair<FEType, QBase*>, FEBase*>::iterator it = d_fe_cache.find(key);
+    if (it != d_fe_cache.end()) return it->second;
+
+    // Build a new FE object and compute the shape function values at the
+    // quadrature points.  The values to be computed must be requested prior to
+    // the first call to reinit().
+    AutoPtr<FEBase> fe = FEBase::build(elem->dim(), fe_type);
+    fe->get_JxW();
+    fe->get_phi();
+    fe->attach_quadrature_rule(qrule);
+    fe->reinit(elem);
+    return d_fe_cache[key] = fe.release();
+} // getCachedFE
+
+int
+FEDataManager::getSpreadScratchDataIndex(const int f_data_idx)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<hier::Variable<NDIM> > f_var;
+    var_db->mapIndexToVariable(f_data_idx, f_var);
+    const IntVector<NDIM>& f_gcw = var_db->getPatchDescriptor()->getPatchDataFactory(f_data_idx)->getGhostCellWidth();
+
+    // Reuse the previously registered scratch data index, provided that it
+    // still corresponds to the same variable and ghost cell width.
+    std::map<int, int>::iterator it = d_spread_scratch_idxs.find(f_data_idx);
+    if (it != d_spread_scratch_idxs.end())
+    {
+        const int scratch_idx = it->second;
+        Pointer<hier::Variable<NDIM> > scratch_var;
+        var_db->mapIndexToVariable(scratch_idx, scratch_var);
+        const IntVector<NDIM>& scratch_gcw =
+            var_db->getPatchDescriptor()->getPatchDataFactory(scratch_idx)->getGhostCellWidth();
+        if (scratch_var == f_var && scratch_gcw == f_gcw) return scratch_idx;
+        for (int ln = 0; d_hierarchy && ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (level->checkAllocated(scratch_idx)) level->deallocatePatchData(scratch_idx);
+        }
+        var_db->removePatchDataIndex(scratch_idx);
+        d_spread_scratch_idxs.erase(it);
+    }
+    const int scratch_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
+    d_spread_scratch_idxs[f_data_idx] = scratch_idx;
+    return scratch_idx;
+} // getSpreadScratchDataIndex
+
+void
+FEDataManager::clearSpreadScratchData()
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (std::map<int, int>::iterator it = d_spread_scratch_idxs.begin(); it != d_spread_scratch_idxs.end(); ++it)
+    {
+        const int scratch_idx = it->second;
+        for (int ln = 0; d_hierarchy && ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (level->checkAllocated(scratch_idx)) level->deallocatePatchData(scratch_idx);
+        }
+        var_db->removePatchDataIndex(scratch_idx);
+    }
+    d_spread_scratch_idxs.clear();
+    return;
+} // clearSpreadScratchData
+
 void
 FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_ln)
 {
@@ -119,6 +119,7 @@
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
+#include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/RestartManager.h"
 #include "tbox/SAMRAI_MPI.h"
@@ -172,6 +173,68 @@ static const double TOL = sqrt(std::numeric_limits<double>::epsilon());
 
 // Version of LDataManager restart file data.
 static const int LDATA_MANAGER_VERSION = 1;
+
+// Determine the nonnegative coefficients a and b that minimize sum_p (t_p -
+// a*x_p - b*y_p)^2, given the sums Sxx = sum_p x_p^2, Sxy = sum_p x_p*y_p, Syy
+// = sum_p y_p^2, Sxt = sum_p x_p*t_p, and Syt = sum_p y_p*t_p.  When the
+// unconstrained minimizer is not feasible, or when x and y are (nearly)
+// collinear, the better of the two single-term fits is used, with ties going
+// to the x term.
+inline void
+fit_nonnegative_coefs(double& a,
+                      double& b,
+                      const double Sxx,
+                      const double Sxy,
+                      const double Syy,
+                      const double Sxt,
+                      const double Syt)
+{
+    const double det = Sxx * Syy - Sxy * Sxy;
+    if (det > TOL * Sxx * Syy)
+    {
+        a = (Syy * Sxt - Sxy * Syt) / det;
+        b = (Sxx * Syt - Sxy * Sxt) / det;
+        if (a >= 0.0 && b >= 0.0) return;
+    }
+    const double a_only = Sxx > 0.0 ? std::max(Sxt / Sxx, 0.0) : 0.0;
+    const double b_only = Syy > 0.0 ? std::max(Syt / Syy, 0.0) : 0.0;
+    if (a_only * Sxt >= b_only * Syt)
+    {
+        a = a_only;
+        b = 0.0;
+    }
+    else
+    {
+        a = 0.0;
+        b = b_only;
+    }
+    return;
+} // fit_nonnegative_coefs
+
+// Sum the wallclock times accumulated by the named timers.  The timers are
+// looked up rather than created, so that a misspelled or inactive timer is
+// reported instead of silently contributing zero time.
+double
+get_total_wallclock_time(const std::vector<std::string>& timer_names, const std::string& object_name)
+{
+    TimerManager* timer_manager = TimerManager::getManager();
+    double time = 0.0;
+    for (unsigned int k = 0; k < timer_names.size(); ++k)
+    {
+        Pointer<Timer> timer;
+        if (!timer_manager->checkTimerExists(timer, timer_names[k]) || !timer->isActive())
+        {
+            TBOX_ERROR(object_name << "::updateWorkloadEstimates():\n"
+                                   << "  workload timer "
+                                   << timer_names[k]
+                                   << " does not exist or is not active.\n"
+                                   << "  check the timer name and the TimerManager timer_list.\n"
+                                   << std::endl);
+        }
+        time += timer->getTotalWallclockTime();
+    }
+    return time;
+} // get_total_wallclock_time
 }
 
 const std::string LDataManager::POSN_DATA_NAME = "X";
@@ -309,6 +372,20 @@ LDataManager::getPatchLevels() const
     return std::make_pair(d_coarsest_ln, d_finest_ln + 1);
 } // getPatchLevels
 
+void
+LDataManager::setUseThreadedSpreading(const bool use_threaded_spreading)
+{
+    d_use_threaded_spreading = use_threaded_spreading;
+    return;
+} // setUseThreadedSpreading
+
+void
+LDataManager::setUseCellSortedKernels(const bool use_cell_sorted_kernels)
+{
+    d_use_cell_sorted_kernels = use_cell_sorted_kernels;
+    return;
+} // setUseCellSortedKernels
+
 void
 LDataManager::spread(const int f_data_idx,
                      Pointer<LData> F_data,
@@ -584,6 +661,8 @@ LDataManager::spread(const int f_data_idx,
 {
     IBTK_TIMER_START(t_spread);
 
+    if (d_use_measured_workload_estimates && d_workload_counts_stale) sampleWorkloadCounts();
+
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -649,26 +728,58 @@ LDataManager::spread(const int f_data_idx,
             if (cc_data)
             {
                 Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-                LEInteractor::spread(
-                    f_cc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                LEInteractor::spread(f_cc_data,
+                                     F_data[ln],
+                                     X_data[ln],
+                                     idx_data,
+                                     patch,
+                                     box,
+                                     periodic_shift,
+                                     spread_kernel_fcn,
+                                     d_use_threaded_spreading,
+                                     d_use_cell_sorted_kernels);
             }
             if (ec_data)
             {
                 Pointer<EdgeData<NDIM, double> > f_ec_data = f_data;
-                LEInteractor::spread(
-                    f_ec_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                LEInteractor::spread(f_ec_data,
+                                     F_data[ln],
+                                     X_data[ln],
+                                     idx_data,
+                                     patch,
+                                     box,
+                                     periodic_shift,
+                                     spread_kernel_fcn,
+                                     d_use_threaded_spreading,
+                                     d_use_cell_sorted_kernels);
             }
             if (nc_data)
             {
                 Pointer<NodeData<NDIM, double> > f_nc_data = f_data;
-                LEInteractor::spread(
-                    f_nc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                LEInteractor::spread(f_nc_data,
+                                     F_data[ln],
+                                     X_data[ln],
+                                     idx_data,
+                                     patch,
+                                     box,
+                                     periodic_shift,
+                                     spread_kernel_fcn,
+                                     d_use_threaded_spreading,
+                                     d_use_cell_sorted_kernels);
             }
             if (sc_data)
             {
                 Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-                LEInteractor::spread(
-                    f_sc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                LEInteractor::spread(f_sc_data,
+                                     F_data[ln],
+                                     X_data[ln],
+                                     idx_data,
+                                     patch,
+                                     box,
+                                     periodic_shift,
+                                     spread_kernel_fcn,
+                                     d_use_threaded_spreading,
+                                     d_use_cell_sorted_kernels);
             }
             if (f_phys_bdry_op)
             {
@@ -733,6 +844,8 @@ LDataManager::interp(const int f_data_idx,
 {
     IBTK_TIMER_START(t_interp);
 
+    if (d_use_measured_workload_estimates && d_workload_counts_stale) sampleWorkloadCounts();
+
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -787,7 +900,8 @@ LDataManager::interp(const int f_data_idx,
                                           patch,
                                           box,
                                           periodic_shift,
-                                          d_default_interp_kernel_fcn);
+                                          d_default_interp_kernel_fcn,
+                                          d_use_cell_sorted_kernels);
             }
             if (ec_data)
             {
@@ -799,7 +913,8 @@ LDataManager::interp(const int f_data_idx,
                                           patch,
                                           box,
                                           periodic_shift,
-                                          d_default_interp_kernel_fcn);
+                                          d_default_interp_kernel_fcn,
+                                          d_use_cell_sorted_kernels);
             }
             if (nc_data)
             {
@@ -811,7 +926,8 @@ LDataManager::interp(const int f_data_idx,
                                           patch,
                                           box,
                                           periodic_shift,
-                                          d_default_interp_kernel_fcn);
+                                          d_default_interp_kernel_fcn,
+                                          d_use_cell_sorted_kernels);
             }
             if (sc_data)
             {
@@ -823,7 +939,8 @@ LDataManager::interp(const int f_data_idx,
                                           patch,
                                           box,
                                           periodic_shift,
-                                          d_default_interp_kernel_fcn);
+                                          d_default_interp_kernel_fcn,
+                                          d_use_cell_sorted_kernels);
             }
         }
     }
@@ -1549,6 +1666,9 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
 {
     IBTK_TIMER_START(t_end_data_redistribution);
 
+    // The workload counts must be resampled for the new configuration.
+    d_workload_counts_stale = true;
+
     const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
     const int finest_ln = (finest_ln_in == -1) ? d_finest_ln : finest_ln_in;
 
@@ -1714,6 +1834,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     int ierr;
 
     std::vector<AO> new_ao(finest_ln + 1);
+    std::vector<bool> reuse_ao(finest_ln + 1, false);
 
     std::vector<std::vector<Vec> > src_vec(finest_ln + 1);
     std::vector<std::vector<Vec> > dst_vec(finest_ln + 1);
@@ -1763,21 +1884,63 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         dst_vec[level_number].resize(num_data);
         scatter[level_number].resize(num_data);
 
-        // Get the new distribution of nodes for the level.
+        // Get the new distribution of nodes for the level.  When incremental
+        // redistribution is enabled and the patch configuration is unchanged,
+        // the relative ordering of the nodes that remain on this processor is
+        // preserved.
         //
         // NOTE: This process updates the local PETSc indices of the LNodeSet
         // objects contained in the current patch.
-        computeNodeDistribution(new_ao[level_number],
-                                d_local_lag_indices[level_number],
-                                d_nonlocal_lag_indices[level_number],
-                                d_local_petsc_indices[level_number],
-                                d_nonlocal_petsc_indices[level_number],
-                                d_num_nodes[level_number],
-                                d_node_offset[level_number],
-                                level_number);
+        const bool preserve_local_ordering = d_use_incremental_data_redistribution && d_ao[level_number] &&
+                                             patchConfigurationIsUnchanged(level_number);
+        const std::vector<int> old_nonlocal_petsc_indices =
+            preserve_local_ordering ? d_nonlocal_petsc_indices[level_number] : std::vector<int>();
+        reuse_ao[level_number] = computeNodeDistribution(new_ao[level_number],
+                                                         d_local_lag_indices[level_number],
+                                                         d_nonlocal_lag_indices[level_number],
+                                                         d_local_petsc_indices[level_number],
+                                                         d_nonlocal_petsc_indices[level_number],
+                                                         d_num_nodes[level_number],
+                                                         d_node_offset[level_number],
+                                                         level_number,
+                                                         preserve_local_ordering);
         num_local_nodes[level_number] = static_cast<int>(d_local_lag_indices[level_number].size());
         num_nonlocal_nodes[level_number] = static_cast<int>(d_nonlocal_lag_indices[level_number].size());
 
+        // If no node has changed processors, the global layout of the data is
+        // unchanged.  The existing Vec objects are kept if the ghost nodes are
+        // also unchanged on every processor; otherwise, only the local values
+        // are copied into new Vec objects with the updated ghost indices.
+        //
+        // NOTE: Creating the ghosted Vec objects is a collective operation, so
+        // all processors must agree on whether the existing objects are kept.
+        if (reuse_ao[level_number])
+        {
+            const int ghost_nodes_unchanged =
+                d_nonlocal_petsc_indices[level_number] == old_nonlocal_petsc_indices ? 1 : 0;
+            if (SAMRAI_MPI::minReduction(ghost_nodes_unchanged) == 1) continue;
+            std::map<std::string, Pointer<LData> >::iterator it;
+            int i;
+            for (it = level_data.begin(), i = 0; it != level_data.end(); ++it, ++i)
+            {
+                Pointer<LData> data = it->second;
+                const int depth = data->getDepth();
+                src_vec[level_number][i] = data->getVec();
+                ierr = VecCreateGhostBlock(
+                    PETSC_COMM_WORLD,
+                    depth,
+                    depth * num_local_nodes[level_number],
+                    PETSC_DECIDE,
+                    num_nonlocal_nodes[level_number],
+                    num_nonlocal_nodes[level_number] > 0 ? &d_nonlocal_petsc_indices[level_number][0] : NULL,
+                    &dst_vec[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecCopy(src_vec[level_number][i], dst_vec[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+            }
+            continue;
+        }
+
         // Setup src indices.
         std::vector<int> src_inds(num_local_nodes[level_number]);
         for (int k = 0; k < num_local_nodes[level_number]; ++k)
@@ -1937,14 +2100,18 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         int i;
         for (it = level_data.begin(), i = 0; it != level_data.end(); ++it, ++i)
         {
-            ierr = VecScatterEnd(scatter[level_number][i],
-                                 src_vec[level_number][i],
-                                 dst_vec[level_number][i],
-                                 INSERT_VALUES,
-                                 SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecScatterDestroy(&scatter[level_number][i]);
-            IBTK_CHKERRQ(ierr);
+            if (!dst_vec[level_number][i]) continue;
+            if (scatter[level_number][i])
+            {
+                ierr = VecScatterEnd(scatter[level_number][i],
+                                     src_vec[level_number][i],
+                                     dst_vec[level_number][i],
+                                     INSERT_VALUES,
+                                     SCATTER_FORWARD);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecScatterDestroy(&scatter[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+            }
             Pointer<LData> data = it->second;
             data->resetData(dst_vec[level_number][i], d_nonlocal_petsc_indices[level_number]);
         }
@@ -1960,12 +2127,15 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     {
         d_needs_synch[level_number] = false;
 
-        if (d_ao[level_number])
+        if (!reuse_ao[level_number])
         {
-            ierr = AODestroy(&d_ao[level_number]);
-            IBTK_CHKERRQ(ierr);
+            if (d_ao[level_number])
+            {
+                ierr = AODestroy(&d_ao[level_number]);
+                IBTK_CHKERRQ(ierr);
+            }
+            d_ao[level_number] = new_ao[level_number];
         }
-        d_ao[level_number] = new_ao[level_number];
 
         for (std::map<int, IS>::iterator it = src_IS[level_number].begin(); it != src_IS[level_number].end(); ++it)
         {
@@ -1980,6 +2150,21 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         }
     }
 
+    // Record the patch configuration used to distribute the data.
+    d_redistribution_patch_boxes.resize(std::max(finest_ln + 1, static_cast<int>(d_redistribution_patch_boxes.size())));
+    d_redistribution_patch_procs.resize(std::max(finest_ln + 1, static_cast<int>(d_redistribution_patch_procs.size())));
+    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+        const Array<int>& processor_mapping = level->getProcessorMapping().getProcessorMapping();
+        d_redistribution_patch_boxes[level_number] = level->getBoxes();
+        d_redistribution_patch_procs[level_number].resize(processor_mapping.size());
+        for (int k = 0; k < processor_mapping.size(); ++k)
+        {
+            d_redistribution_patch_procs[level_number][k] = processor_mapping[k];
+        }
+    }
+
     // If a Silo data writer is registered with the manager, give it access to
     // the new application orderings.
     if (d_silo_writer)
@@ -1991,6 +2176,13 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     return;
 } // endDataRedistribution
 
+void
+LDataManager::setUseIncrementalDataRedistribution(const bool use_incremental_data_redistribution)
+{
+    d_use_incremental_data_redistribution = use_incremental_data_redistribution;
+    return;
+} // setUseIncrementalDataRedistribution
+
 void
 LDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -2006,14 +2198,57 @@ LDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int finest
     TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
 #endif
 
+    if (d_use_measured_workload_estimates) calibrateWorkloadEstimates();
+
     updateNodeCountData(coarsest_ln, finest_ln);
     HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, coarsest_ln, finest_ln);
     hier_cc_data_ops.axpy(d_workload_idx, d_beta_work, d_node_count_idx, d_workload_idx);
+    addSpringAndPatchWorkload(coarsest_ln, finest_ln);
 
     IBTK_TIMER_STOP(t_update_workload_estimates);
     return;
 } // updateWorkloadEstimates
 
+void
+LDataManager::setUseMeasuredWorkloadEstimates(const bool use_measured_workload_estimates,
+                                              const std::vector<std::string>& marker_timer_names,
+                                              const std::vector<std::string>& force_timer_names,
+                                              const std::vector<std::string>& eul_timer_names)
+{
+    if (use_measured_workload_estimates && eul_timer_names.empty())
+    {
+        TBOX_ERROR(d_object_name << "::setUseMeasuredWorkloadEstimates():\n"
+                                 << "  at least one Eulerian timer must be specified.\n"
+                                 << std::endl);
+    }
+    d_use_measured_workload_estimates = use_measured_workload_estimates;
+    d_workload_marker_timer_names = marker_timer_names;
+    if (d_workload_marker_timer_names.empty())
+    {
+        d_workload_marker_timer_names.push_back("IBTK::LDataManager::spread()");
+        d_workload_marker_timer_names.push_back("IBTK::LDataManager::interp()");
+    }
+    d_workload_force_timer_names = force_timer_names;
+    d_workload_eul_timer_names = eul_timer_names;
+
+    // The timers may not have been created yet, so the reference times are
+    // not set until the counts are first sampled.
+    d_workload_num_local_nodes = 0.0;
+    d_workload_num_local_springs = 0.0;
+    d_workload_num_local_cells = 0.0;
+    d_workload_num_local_patches = 0.0;
+    d_workload_counts_stale = true;
+    return;
+} // setUseMeasuredWorkloadEstimates
+
+void
+LDataManager::registerSpringCountCallback(SpringCountCallbackFcnPtr callback, void* ctx)
+{
+    d_spring_count_callback = callback;
+    d_spring_count_callback_ctx = ctx;
+    return;
+} // registerSpringCountCallback
+
 void
 LDataManager::updateNodeCountData(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -2064,6 +2299,9 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
 {
     IBTK_TIMER_START(t_initialize_level_data);
 
+    // The workload counts must be resampled for the new configuration.
+    d_workload_counts_stale = true;
+
 #if !defined(NDEBUG)
     TBOX_ASSERT(hierarchy);
     TBOX_ASSERT((level_number >= 0) && (level_number <= hierarchy->getFinestLevelNumber()));
@@ -2376,6 +2614,9 @@ LDataManager::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM>
 {
     IBTK_TIMER_START(t_reset_hierarchy_configuration);
 
+    // The workload counts must be resampled for the new configuration.
+    d_workload_counts_stale = true;
+
 #if !defined(NDEBUG)
     TBOX_ASSERT(hierarchy);
     TBOX_ASSERT((coarsest_ln >= 0) && (coarsest_ln <= finest_ln) && (finest_ln <= hierarchy->getFinestLevelNumber()));
@@ -2545,6 +2786,8 @@ LDataManager::putToDatabase(Pointer<Database> db)
     db->putInteger("d_coarsest_ln", d_coarsest_ln);
     db->putInteger("d_finest_ln", d_finest_ln);
     db->putDouble("d_beta_work", d_beta_work);
+    db->putDouble("d_beta_spring", d_beta_spring);
+    db->putDouble("d_beta_patch", d_beta_patch);
 
     // Write out data that is stored on a level-by-level basis.
     for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
@@ -2666,14 +2909,32 @@ LDataManager::LDataManager(const std::string& object_name,
       d_lag_node_index_current_idx(-1),
       d_lag_node_index_scratch_idx(-1),
       d_beta_work(1.0),
+      d_beta_spring(0.0),
+      d_beta_patch(0.0),
       d_workload_var(NULL),
       d_workload_idx(-1),
       d_output_workload(false),
+      d_use_measured_workload_estimates(false),
+      d_workload_marker_timer_names(),
+      d_workload_force_timer_names(),
+      d_workload_eul_timer_names(),
+      d_workload_marker_time(0.0),
+      d_workload_force_time(0.0),
+      d_workload_eul_time(0.0),
+      d_workload_counts_stale(true),
+      d_workload_num_local_nodes(0.0),
+      d_workload_num_local_springs(0.0),
+      d_workload_num_local_cells(0.0),
+      d_workload_num_local_patches(0.0),
+      d_spring_count_callback(NULL),
+      d_spring_count_callback_ctx(NULL),
       d_node_count_var(NULL),
       d_node_count_idx(-1),
       d_output_node_count(false),
       d_default_interp_kernel_fcn(default_interp_kernel_fcn),
       d_default_spread_kernel_fcn(default_spread_kernel_fcn),
+      d_use_threaded_spreading(false),
+      d_use_cell_sorted_kernels(false),
       d_error_if_points_leave_domain(error_if_points_leave_domain),
       d_ghost_width(ghost_width),
       d_lag_node_index_bdry_fill_alg(NULL),
@@ -2693,7 +2954,10 @@ LDataManager::LDataManager(const std::string& object_name,
       d_local_lag_indices(),
       d_nonlocal_lag_indices(),
       d_local_petsc_indices(),
-      d_nonlocal_petsc_indices()
+      d_nonlocal_petsc_indices(),
+      d_use_incremental_data_redistribution(false),
+      d_redistribution_patch_boxes(),
+      d_redistribution_patch_procs()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -2924,7 +3188,7 @@ LDataManager::endNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_
     return;
 } // endNonlocalDataFill
 
-void
+bool
 LDataManager::computeNodeDistribution(AO& ao,
                                       std::vector<int>& local_lag_indices,
                                       std::vector<int>& nonlocal_lag_indices,
@@ -2932,7 +3196,8 @@ LDataManager::computeNodeDistribution(AO& ao,
                                       std::vector<int>& nonlocal_petsc_indices,
                                       unsigned int& num_nodes,
                                       unsigned int& node_offset,
-                                      const int level_number)
+                                      const int level_number,
+                                      const bool preserve_local_ordering)
 {
     IBTK_TIMER_START(t_compute_node_distribution);
 
@@ -2940,6 +3205,8 @@ LDataManager::computeNodeDistribution(AO& ao,
     TBOX_ASSERT(level_number >= d_coarsest_ln && level_number <= d_finest_ln);
 #endif
 
+    std::vector<int> old_local_lag_indices;
+    if (preserve_local_ordering) old_local_lag_indices.swap(local_lag_indices);
     local_lag_indices.clear();
     nonlocal_lag_indices.clear();
     local_petsc_indices.clear();
@@ -2963,15 +3230,48 @@ LDataManager::computeNodeDistribution(AO& ao,
     // Collect the local nodes and assign local indices to the local nodes.
     unsigned int local_offset = 0;
     std::map<int, int> lag_idx_to_petsc_idx;
-#if 1
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-    {
-        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-        for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
+    if (preserve_local_ordering)
+    {
+        // Nodes that were already local to this processor are identified by
+        // their old local PETSc indices and keep their relative ordering.  All
+        // other nodes are appended in the order in which they are encountered.
+        const int old_num_local_nodes = static_cast<int>(old_local_lag_indices.size());
+        std::vector<std::pair<int, LNode*> > retained_nodes;
+        std::vector<LNode*> new_nodes;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
-            LNode* const node_idx = *it;
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
+            {
+                LNode* const node_idx = *it;
+                const int old_local_idx = node_idx->getLocalPETScIndex();
+                if (0 <= old_local_idx && old_local_idx < old_num_local_nodes &&
+                    old_local_lag_indices[old_local_idx] == node_idx->getLagrangianIndex())
+                {
+                    retained_nodes.push_back(std::make_pair(old_local_idx, node_idx));
+                }
+                else
+                {
+                    new_nodes.push_back(node_idx);
+                }
+            }
+        }
+        std::sort(retained_nodes.begin(), retained_nodes.end());
+        std::vector<LNode*> local_nodes;
+        local_nodes.reserve(retained_nodes.size() + new_nodes.size());
+        for (std::vector<std::pair<int, LNode*> >::const_iterator cit = retained_nodes.begin();
+             cit != retained_nodes.end();
+             ++cit)
+        {
+            local_nodes.push_back(cit->second);
+        }
+        local_nodes.insert(local_nodes.end(), new_nodes.begin(), new_nodes.end());
+        local_lag_indices.reserve(local_nodes.size());
+        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+        {
+            LNode* const node_idx = *cit;
             const int lag_idx = node_idx->getLagrangianIndex();
             local_lag_indices.push_back(lag_idx);
             const int petsc_idx = local_offset++;
@@ -2979,20 +3279,17 @@ LDataManager::computeNodeDistribution(AO& ao,
             lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
         }
     }
-#else
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    else
     {
-        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+#if 1
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
-            const Index<NDIM>& i = b();
-            if (!idx_data->isElement(i)) continue;
-            const LNodeSet* const node_set = idx_data->getItem(i);
-            for (LNodeSet::const_iterator node_it = node_set->begin(); node_it != node_set->end(); ++node_it)
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
             {
-                LNode* const node_idx = *node_it;
+                LNode* const node_idx = *it;
                 const int lag_idx = node_idx->getLagrangianIndex();
                 local_lag_indices.push_back(lag_idx);
                 const int petsc_idx = local_offset++;
@@ -3000,8 +3297,30 @@ LDataManager::computeNodeDistribution(AO& ao,
                 lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
             }
         }
-    }
+#else
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const Index<NDIM>& i = b();
+                if (!idx_data->isElement(i)) continue;
+                const LNodeSet* const node_set = idx_data->getItem(i);
+                for (LNodeSet::const_iterator node_it = node_set->begin(); node_it != node_set->end(); ++node_it)
+                {
+                    LNode* const node_idx = *node_it;
+                    const int lag_idx = node_idx->getLagrangianIndex();
+                    local_lag_indices.push_back(lag_idx);
+                    const int petsc_idx = local_offset++;
+                    node_idx->setLocalPETScIndex(petsc_idx);
+                    lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+                }
+            }
+        }
 #endif
+    }
 
     // Determine the Lagrangian indices of the nonlocal nodes.
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
@@ -3058,7 +3377,11 @@ LDataManager::computeNodeDistribution(AO& ao,
                    << "\n");
     }
 
-    computeNodeOffsets(num_nodes, node_offset, num_local_nodes);
+    // When the local ordering is preserved, the existing AO object remains
+    // valid provided that the local nodes are unchanged on every processor.
+    const bool reuse_ao =
+        preserve_local_ordering && SAMRAI_MPI::minReduction(local_lag_indices == old_local_lag_indices ? 1 : 0) == 1;
+    if (!reuse_ao) computeNodeOffsets(num_nodes, node_offset, num_local_nodes);
 
     // Determine the PETSc ordering and setup the new AO object.
     const int num_proc_nodes = num_local_nodes + num_nonlocal_nodes;
@@ -3073,19 +3396,22 @@ LDataManager::computeNodeDistribution(AO& ao,
         local_petsc_indices[k] = node_offset + k;
     }
 
-    if (ao)
+    if (!reuse_ao)
     {
-        ierr = AODestroy(&ao);
+        if (ao)
+        {
+            ierr = AODestroy(&ao);
+            IBTK_CHKERRQ(ierr);
+        }
+
+        ierr = AOCreateMapping(PETSC_COMM_WORLD,
+                               num_local_nodes,
+                               num_local_nodes > 0 ? &node_indices[0] : NULL,
+                               num_local_nodes > 0 ? &local_petsc_indices[0] : NULL,
+                               &ao);
         IBTK_CHKERRQ(ierr);
     }
 
-    ierr = AOCreateMapping(PETSC_COMM_WORLD,
-                           num_local_nodes,
-                           num_local_nodes > 0 ? &node_indices[0] : NULL,
-                           num_local_nodes > 0 ? &local_petsc_indices[0] : NULL,
-                           &ao);
-    IBTK_CHKERRQ(ierr);
-
     // Determine the PETSc local to global mapping (including PETSc Vec ghost
     // indices).
     //
@@ -3093,7 +3419,7 @@ LDataManager::computeNodeDistribution(AO& ao,
     // PETSc ordering.
     node_indices.reserve(node_indices.size() + nonlocal_lag_indices.size());
     node_indices.insert(node_indices.end(), nonlocal_lag_indices.begin(), nonlocal_lag_indices.end());
-    ierr = AOApplicationToPetsc(ao,
+    ierr = AOApplicationToPetsc(reuse_ao ? d_ao[level_number] : ao,
                                 (num_proc_nodes > 0 ? num_proc_nodes : static_cast<int>(s_ao_dummy.size())),
                                 (num_proc_nodes > 0 ? &node_indices[0] : &s_ao_dummy[0]));
     IBTK_CHKERRQ(ierr);
@@ -3118,9 +3444,34 @@ LDataManager::computeNodeDistribution(AO& ao,
     }
 
     IBTK_TIMER_STOP(t_compute_node_distribution);
-    return;
+    return reuse_ao;
 } // computeNodeDistribution
 
+bool
+LDataManager::patchConfigurationIsUnchanged(const int level_number) const
+{
+    if (level_number >= static_cast<int>(d_redistribution_patch_boxes.size())) return false;
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    const BoxArray<NDIM>& boxes = level->getBoxes();
+    const BoxArray<NDIM>& old_boxes = d_redistribution_patch_boxes[level_number];
+    const Array<int>& processor_mapping = level->getProcessorMapping().getProcessorMapping();
+    const std::vector<int>& old_processor_mapping = d_redistribution_patch_procs[level_number];
+    if (boxes.getNumberOfBoxes() != old_boxes.getNumberOfBoxes() ||
+        processor_mapping.size() != static_cast<int>(old_processor_mapping.size()))
+    {
+        return false;
+    }
+    for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+    {
+        if (!(boxes[k] == old_boxes[k])) return false;
+    }
+    for (int k = 0; k < processor_mapping.size(); ++k)
+    {
+        if (processor_mapping[k] != old_processor_mapping[k]) return false;
+    }
+    return true;
+} // patchConfigurationIsUnchanged
+
 void
 LDataManager::computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_offset, const unsigned int num_local_nodes)
 {
@@ -3141,6 +3492,204 @@ LDataManager::computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_off
     return;
 } // computeNodeOffsets
 
+void
+LDataManager::calibrateWorkloadEstimates()
+{
+    // Determine the time accumulated since the previous calibration.
+    double marker_time, force_time, eul_time;
+    getWorkloadTimes(marker_time, force_time, eul_time);
+    const double local_marker_time = marker_time - d_workload_marker_time;
+    const double local_force_time = force_time - d_workload_force_time;
+    const double local_eul_time = eul_time - d_workload_eul_time;
+
+    // The counts were sampled in the hierarchy configuration for which the
+    // times were measured, which may since have been changed by a regrid.
+    const double n = d_workload_num_local_nodes;
+    const double s = d_workload_num_local_springs;
+    const double c = d_workload_num_local_cells;
+    const double q = d_workload_num_local_patches;
+
+    // Fit the cost of each category of work by least squares over all
+    // processes, i.e., minimize sum_p (t_p - a*x_p - b*y_p)^2, in which x and
+    // y are the counts used to model that category of work.  Only the sums
+    // required to form the normal equations are reduced.
+    enum
+    {
+        MARKER_TIME = 0,
+        FORCE_TIME,
+        EUL_TIME,
+        MARKER_NODE,
+        FORCE_NODE,
+        FORCE_SPRING,
+        EUL_CELL,
+        EUL_PATCH,
+        NODE_NODE,
+        NODE_SPRING,
+        SPRING_SPRING,
+        CELL_CELL,
+        CELL_PATCH,
+        PATCH_PATCH,
+        NUM_SUMS
+    };
+    double sums[NUM_SUMS];
+    sums[MARKER_TIME] = local_marker_time;
+    sums[FORCE_TIME] = local_force_time;
+    sums[EUL_TIME] = local_eul_time;
+    sums[MARKER_NODE] = local_marker_time * n;
+    sums[FORCE_NODE] = local_force_time * n;
+    sums[FORCE_SPRING] = local_force_time * s;
+    sums[EUL_CELL] = local_eul_time * c;
+    sums[EUL_PATCH] = local_eul_time * q;
+    sums[NODE_NODE] = n * n;
+    sums[NODE_SPRING] = n * s;
+    sums[SPRING_SPRING] = s * s;
+    sums[CELL_CELL] = c * c;
+    sums[CELL_PATCH] = c * q;
+    sums[PATCH_PATCH] = q * q;
+    SAMRAI_MPI::sumReduction(sums, NUM_SUMS);
+
+    // Skip the calibration if no work has been timed, e.g., when the workload
+    // is updated level-by-level immediately after a full-hierarchy update, or
+    // if the counts have not yet been sampled.
+    if (!(sums[MARKER_TIME] > 0.0 && sums[EUL_TIME] > 0.0 && sums[NODE_NODE] > 0.0 && sums[CELL_CELL] > 0.0)) return;
+
+    d_workload_marker_time = marker_time;
+    d_workload_force_time = force_time;
+    d_workload_eul_time = eul_time;
+
+    const double marker_coef = sums[MARKER_NODE] / sums[NODE_NODE];
+    double force_coef, spring_coef, cell_coef, patch_coef;
+    fit_nonnegative_coefs(force_coef,
+                          spring_coef,
+                          sums[NODE_NODE],
+                          sums[NODE_SPRING],
+                          sums[SPRING_SPRING],
+                          sums[FORCE_NODE],
+                          sums[FORCE_SPRING]);
+    fit_nonnegative_coefs(
+        cell_coef, patch_coef, sums[CELL_CELL], sums[CELL_PATCH], sums[PATCH_PATCH], sums[EUL_CELL], sums[EUL_PATCH]);
+    if (cell_coef > 0.0)
+    {
+        d_beta_work = (marker_coef + force_coef) / cell_coef;
+        d_beta_spring = spring_coef / cell_coef;
+        d_beta_patch = patch_coef / cell_coef;
+    }
+
+    // Compare the load imbalance predicted by the workload model to the
+    // measured load imbalance.
+    const int num_procs = SAMRAI_MPI::getNodes();
+    double loads[2] = { c + d_beta_work * n + d_beta_spring * s + d_beta_patch * q,
+                        local_marker_time + local_force_time + local_eul_time };
+    double max_loads[2] = { loads[0], loads[1] };
+    SAMRAI_MPI::sumReduction(loads, 2);
+    SAMRAI_MPI::maxReduction(max_loads, 2);
+    plog << d_object_name << "::updateWorkloadEstimates(): calibrated beta_work = " << d_beta_work
+         << ", beta_spring = " << d_beta_spring << ", beta_patch = " << d_beta_patch
+         << " (marker cost = " << marker_coef << ", force cost = " << force_coef << ", spring cost = " << spring_coef
+         << ", cell cost = " << cell_coef << ", patch cost = " << patch_coef << ")\n";
+    if (loads[0] > 0.0 && loads[1] > 0.0)
+    {
+        plog << d_object_name << "::updateWorkloadEstimates(): predicted load imbalance (max/mean) = "
+             << max_loads[0] / (loads[0] / num_procs)
+             << ", measured load imbalance (max/mean) = " << max_loads[1] / (loads[1] / num_procs) << "\n";
+    }
+    return;
+} // calibrateWorkloadEstimates
+
+void
+LDataManager::getWorkloadTimes(double& marker_time, double& force_time, double& eul_time) const
+{
+    marker_time = get_total_wallclock_time(d_workload_marker_timer_names, d_object_name);
+    force_time = get_total_wallclock_time(d_workload_force_timer_names, d_object_name);
+    eul_time = get_total_wallclock_time(d_workload_eul_timer_names, d_object_name);
+    return;
+} // getWorkloadTimes
+
+void
+LDataManager::sampleWorkloadCounts()
+{
+    d_workload_num_local_nodes = 0.0;
+    d_workload_num_local_springs = 0.0;
+    d_workload_num_local_cells = 0.0;
+    d_workload_num_local_patches = 0.0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (levelContainsLagrangianData(ln))
+        {
+            d_workload_num_local_nodes += getNumberOfLocalNodes(ln);
+            if (d_spring_count_callback)
+            {
+                const std::vector<LNode*>& local_nodes = d_lag_mesh[ln]->getLocalNodes();
+                for (std::vector<LNode*>::const_iterator it = local_nodes.begin(); it != local_nodes.end(); ++it)
+                {
+                    d_workload_num_local_springs += d_spring_count_callback(**it, d_spring_count_callback_ctx);
+                }
+            }
+        }
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            d_workload_num_local_cells += level->getPatch(p())->getBox().size();
+            d_workload_num_local_patches += 1.0;
+        }
+    }
+    d_workload_counts_stale = false;
+
+    // Only time accumulated in this configuration is used in the next
+    // calibration.
+    getWorkloadTimes(d_workload_marker_time, d_workload_force_time, d_workload_eul_time);
+    return;
+} // sampleWorkloadCounts
+
+void
+LDataManager::addSpringAndPatchWorkload(const int coarsest_ln, const int finest_ln)
+{
+    const bool add_spring_workload = d_spring_count_callback && d_beta_spring != 0.0;
+    const bool add_patch_workload = d_beta_patch != 0.0;
+    if (!add_spring_workload && !add_patch_workload) return;
+    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(d_workload_idx);
+
+            // The per-patch cost is distributed uniformly over the cells of
+            // the patch.
+            if (add_patch_workload)
+            {
+                const double patch_workload = d_beta_patch / static_cast<double>(patch_box.size());
+                for (Box<NDIM>::Iterator b(patch_box); b; b++)
+                {
+                    (*workload_data)(b()) += patch_workload;
+                }
+            }
+
+            // The per-spring cost is assigned to the cells containing the
+            // nodes with which the springs are associated.
+            if (add_spring_workload && levelContainsLagrangianData(level_number))
+            {
+                const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+                for (LNodeSetData::SetIterator it(*idx_data); it; it++)
+                {
+                    const Index<NDIM>& i = it.getIndex();
+                    if (!patch_box.contains(i)) continue;
+                    const LNodeSet& node_set = *it;
+                    int num_springs = 0;
+                    for (LNodeSet::const_iterator n = node_set.begin(); n != node_set.end(); ++n)
+                    {
+                        num_springs += d_spring_count_callback(**n, d_spring_count_callback_ctx);
+                    }
+                    (*workload_data)(i) += d_beta_spring * static_cast<double>(num_springs);
+                }
+            }
+        }
+    }
+    return;
+} // addSpringAndPatchWorkload
+
 void
 LDataManager::getFromRestart()
 {
@@ -3166,6 +3715,8 @@ LDataManager::getFromRestart()
     d_coarsest_ln = db->getInteger("d_coarsest_ln");
     d_finest_ln = db->getInteger("d_finest_ln");
     d_beta_work = db->getDouble("d_beta_work");
+    if (db->keyExists("d_beta_spring")) d_beta_spring = db->getDouble("d_beta_spring");
+    if (db->keyExists("d_beta_patch")) d_beta_patch = db->getDouble("d_beta_patch");
 
     // Resize some arrays.
     d_level_contains_lag_data.resize(d_finest_ln + 1, false);
@@ -34,6 +34,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -978,6 +979,454 @@ ib4_kernel_fcn(double r)
         return 0.0;
     }
 }
+
+// Number of markers for which kernel weights are computed together by the
+// cell-sorted kernels.
+static const int WEIGHT_BLOCK_SIZE = 8;
+
+// Round to the nearest integer, with halfway cases rounded away from zero
+// (i.e., the Fortran intrinsic NINT).
+inline int
+lagrangian_nint(const double x)
+{
+    return static_cast<int>(x >= 0.0 ? x + 0.5 : x - 0.5);
+}
+
+// Weight functions for the cell-sorted kernels.  For a block of n markers,
+// computeWeights() computes the one-dimensional weights w[i][b] associated
+// with the i-th cell of the stencil of marker b.  The stencil of marker b
+// starts at cell index k_lower[b] relative to the lower index of the patch
+// box, and X_o_dx[b] is the position of the marker in units of the grid
+// spacing relative to the lower corner of the patch.  The loops over the
+// markers in the block contain no branches so that they can be vectorized.
+struct IB4KernelWeights
+{
+    static const int WIDTH = 4;
+
+    static inline void
+    computeWeights(double w[WIDTH][WEIGHT_BLOCK_SIZE],
+                   const double* const X_o_dx,
+                   const int* const k_lower,
+                   const int n)
+    {
+        for (int b = 0; b < n; ++b)
+        {
+            const double r = X_o_dx[b] - ((k_lower[b] + 1) + 0.5);
+            const double q = std::sqrt(1.0 + 4.0 * r * (1.0 - r));
+            w[0][b] = 0.125 * (3.0 - 2.0 * r - q);
+            w[1][b] = 0.125 * (3.0 - 2.0 * r + q);
+            w[2][b] = 0.125 * (1.0 + 2.0 * r + q);
+            w[3][b] = 0.125 * (1.0 + 2.0 * r - q);
+        }
+        return;
+    }
+};
+
+struct IB4W8KernelWeights
+{
+    static const int WIDTH = 8;
+
+    static inline void
+    computeWeights(double w[WIDTH][WEIGHT_BLOCK_SIZE],
+                   const double* const X_o_dx,
+                   const int* const k_lower,
+                   const int n)
+    {
+        for (int b = 0; b < n; ++b)
+        {
+            double r = 0.5 * (X_o_dx[b] - ((k_lower[b] + 3) + 0.5));
+            double q = std::sqrt(1.0 + 4.0 * r * (1.0 - r));
+            w[1][b] = 0.0625 * (3.0 - 2.0 * r - q);
+            w[3][b] = 0.0625 * (3.0 - 2.0 * r + q);
+            w[5][b] = 0.0625 * (1.0 + 2.0 * r + q);
+            w[7][b] = 0.0625 * (1.0 + 2.0 * r - q);
+            r = r + 0.5;
+            q = std::sqrt(1.0 + 4.0 * r * (1.0 - r));
+            w[0][b] = 0.0625 * (3.0 - 2.0 * r - q);
+            w[2][b] = 0.0625 * (3.0 - 2.0 * r + q);
+            w[4][b] = 0.0625 * (1.0 + 2.0 * r + q);
+            w[6][b] = 0.0625 * (1.0 + 2.0 * r - q);
+        }
+        return;
+    }
+};
+
+struct BSpline4KernelWeights
+{
+    static const int WIDTH = 4;
+
+    static inline void
+    computeWeights(double w[WIDTH][WEIGHT_BLOCK_SIZE],
+                   const double* const X_o_dx,
+                   const int* const k_lower,
+                   const int n)
+    {
+        static const double C = 1.0 / 6.0;
+        for (int b = 0; b < n; ++b)
+        {
+            const double f = X_o_dx[b] - ((k_lower[b] + 1) + 0.5);
+            const double f2 = f * f;
+            const double f3 = f2 * f;
+            const double g = 1.0 - f;
+            w[0][b] = C * g * g * g;
+            w[1][b] = C * (3.0 * f3 - 6.0 * f2 + 4.0);
+            w[2][b] = C * (-3.0 * f3 + 3.0 * f2 + 3.0 * f + 1.0);
+            w[3][b] = C * f3;
+        }
+        return;
+    }
+};
+
+struct BSpline6KernelWeights
+{
+    static const int WIDTH = 6;
+
+    static inline void
+    computeWeights(double w[WIDTH][WEIGHT_BLOCK_SIZE],
+                   const double* const X_o_dx,
+                   const int* const k_lower,
+                   const int n)
+    {
+        static const double C = 1.0 / 120.0;
+        for (int b = 0; b < n; ++b)
+        {
+            const double f = X_o_dx[b] - ((k_lower[b] + 2) + 0.5);
+            const double f2 = f * f;
+            const double f3 = f2 * f;
+            const double f4 = f3 * f;
+            const double f5 = f4 * f;
+            const double g = 1.0 - f;
+            const double g2 = g * g;
+            w[0][b] = C * g2 * g2 * g;
+            w[1][b] = C * (26.0 - 50.0 * f + 20.0 * f2 + 20.0 * f3 - 20.0 * f4 + 5.0 * f5);
+            w[2][b] = C * (66.0 - 60.0 * f2 + 30.0 * f4 - 10.0 * f5);
+            w[3][b] = C * (26.0 + 50.0 * f + 20.0 * f2 - 20.0 * f3 - 20.0 * f4 + 10.0 * f5);
+            w[4][b] = C * (1.0 + 5.0 * f + 10.0 * f2 + 10.0 * f3 + 5.0 * f4 - 5.0 * f5);
+            w[5][b] = C * f5;
+        }
+        return;
+    }
+};
+
+// Compute a permutation of the local indices that orders the markers by the
+// first cell of their interaction stencils, so that consecutive markers access
+// nearby grid data.  The relative ordering of markers with the same stencil is
+// preserved.
+class StencilCellComparator
+{
+public:
+    StencilCellComparator(const std::vector<int>& cell_keys) : d_cell_keys(cell_keys)
+    {
+        return;
+    }
+
+    bool operator()(const int l1, const int l2) const
+    {
+        return d_cell_keys[l1] < d_cell_keys[l2];
+    }
+
+private:
+    const std::vector<int>& d_cell_keys;
+};
+
+void
+compute_cell_sorted_ordering(std::vector<int>& order,
+                             const int stencil_width,
+                             const double* const X,
+                             const double* const x_lower,
+                             const double* const dx,
+                             const int* const ig_lower,
+                             const int* const ig_upper,
+                             const int* const ilower,
+                             const std::vector<int>& local_indices,
+                             const std::vector<double>& periodic_shifts)
+{
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    std::vector<int> cell_keys(num_local_indices);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        int key = 0;
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            const double X_o_dx = (X[d + s * NDIM] + periodic_shifts[d + l * NDIM] - x_lower[d]) / dx[d];
+            const int ic = lagrangian_nint(X_o_dx) + ilower[d] - stencil_width / 2;
+            const int ic_clamped = std::min(std::max(ic, ig_lower[d]), ig_upper[d]);
+            key = key * (ig_upper[d] - ig_lower[d] + 1) + (ic_clamped - ig_lower[d]);
+        }
+        cell_keys[l] = key;
+    }
+    order.resize(num_local_indices);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        order[l] = l;
+    }
+    std::stable_sort(order.begin(), order.end(), StencilCellComparator(cell_keys));
+    return;
+}
+
+// Compute the stencil locations and one-dimensional weights for a block of
+// markers.
+template <class KernelWeights>
+inline void
+compute_block_weights(double w[NDIM][KernelWeights::WIDTH][WEIGHT_BLOCK_SIZE],
+                      int ic_lower[NDIM][WEIGHT_BLOCK_SIZE],
+                      const int* const block_l,
+                      const int n,
+                      const double* const X,
+                      const double* const x_lower,
+                      const double* const dx,
+                      const int* const ilower,
+                      const std::vector<int>& local_indices,
+                      const std::vector<double>& periodic_shifts)
+{
+    double X_o_dx[WEIGHT_BLOCK_SIZE];
+    int k_lower[WEIGHT_BLOCK_SIZE];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        for (int b = 0; b < n; ++b)
+        {
+            const int l = block_l[b];
+            const int s = local_indices[l];
+            X_o_dx[b] = (X[d + s * NDIM] + periodic_shifts[d + l * NDIM] - x_lower[d]) / dx[d];
+            k_lower[b] = lagrangian_nint(X_o_dx[b]) - KernelWeights::WIDTH / 2;
+            ic_lower[d][b] = k_lower[b] + ilower[d];
+        }
+        KernelWeights::computeWeights(w[d], X_o_dx, k_lower, n);
+    }
+    return;
+}
+
+// Interpolate cell-centered data (stored in Fortran order over the ghost box
+// [ig_lower,ig_upper]) to the markers, processing the markers in cell-sorted
+// order.  The width of the stencil is a compile-time constant, so that the
+// tensor-product loops can be fully unrolled.
+template <class KernelWeights>
+void
+interpolate_cell_sorted(double* const Q,
+                        const double* const X,
+                        const double* const q,
+                        const int q_depth,
+                        const int* const ilower,
+                        const int* const ig_lower,
+                        const int* const ig_upper,
+                        const double* const x_lower,
+                        const double* const dx,
+                        const std::vector<int>& local_indices,
+                        const std::vector<double>& periodic_shifts)
+{
+    static const int W = KernelWeights::WIDTH;
+    int ng[NDIM];
+    int ghost_box_size = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ng[d] = ig_upper[d] - ig_lower[d] + 1;
+        ghost_box_size *= ng[d];
+    }
+    std::vector<int> order;
+    compute_cell_sorted_ordering(
+        order, W, X, x_lower, dx, ig_lower, ig_upper, ilower, local_indices, periodic_shifts);
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    double w[NDIM][W][WEIGHT_BLOCK_SIZE];
+    int ic_lower[NDIM][WEIGHT_BLOCK_SIZE];
+    for (int k = 0; k < num_local_indices; k += WEIGHT_BLOCK_SIZE)
+    {
+        const int n = std::min(WEIGHT_BLOCK_SIZE, num_local_indices - k);
+        compute_block_weights<KernelWeights>(
+            w, ic_lower, &order[k], n, X, x_lower, dx, ilower, local_indices, periodic_shifts);
+        for (int b = 0; b < n; ++b)
+        {
+            const int s = local_indices[order[k + b]];
+            int istart[NDIM], istop[NDIM];
+            bool interior_stencil = true;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                istart[d] = std::max(ig_lower[d] - ic_lower[d][b], 0);
+                istop[d] = W - 1 - std::max(ic_lower[d][b] + W - 1 - ig_upper[d], 0);
+                interior_stencil = interior_stencil && istart[d] == 0 && istop[d] == W - 1;
+            }
+            const int offset = (ic_lower[0][b] - ig_lower[0]) +
+                               ng[0] * ((ic_lower[1][b] - ig_lower[1])
+#if (NDIM == 3)
+                                        + ng[1] * (ic_lower[2][b] - ig_lower[2])
+#endif
+                                            );
+            for (int depth = 0; depth < q_depth; ++depth)
+            {
+                const double* const q_depth_data = q + depth * ghost_box_size + offset;
+                double V = 0.0;
+                if (interior_stencil)
+                {
+#if (NDIM == 3)
+                    for (int i2 = 0; i2 < W; ++i2)
+                    {
+#endif
+                        for (int i1 = 0; i1 < W; ++i1)
+                        {
+#if (NDIM == 2)
+                            const double wy = w[1][i1][b];
+                            const double* const q_row = q_depth_data + ng[0] * i1;
+#endif
+#if (NDIM == 3)
+                            const double wy = w[1][i1][b] * w[2][i2][b];
+                            const double* const q_row = q_depth_data + ng[0] * (i1 + ng[1] * i2);
+#endif
+                            for (int i0 = 0; i0 < W; ++i0)
+                            {
+                                V += (w[0][i0][b] * wy) * q_row[i0];
+                            }
+                        }
+#if (NDIM == 3)
+                    }
+#endif
+                }
+                else
+                {
+#if (NDIM == 3)
+                    for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+                    {
+#endif
+                        for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                        {
+#if (NDIM == 2)
+                            const double wy = w[1][i1][b];
+                            const double* const q_row = q_depth_data + ng[0] * i1;
+#endif
+#if (NDIM == 3)
+                            const double wy = w[1][i1][b] * w[2][i2][b];
+                            const double* const q_row = q_depth_data + ng[0] * (i1 + ng[1] * i2);
+#endif
+                            for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                            {
+                                V += (w[0][i0][b] * wy) * q_row[i0];
+                            }
+                        }
+#if (NDIM == 3)
+                    }
+#endif
+                }
+                Q[depth + s * q_depth] = V;
+            }
+        }
+    }
+    return;
+}
+
+// Spread values from the markers to cell-centered data (stored in Fortran
+// order over the ghost box [ig_lower,ig_upper]), processing the markers in
+// cell-sorted order.  The width of the stencil is a compile-time constant, so
+// that the tensor-product loops can be fully unrolled.
+template <class KernelWeights>
+void
+spread_cell_sorted(double* const q,
+                   const double* const Q,
+                   const double* const X,
+                   const int q_depth,
+                   const int* const ilower,
+                   const int* const ig_lower,
+                   const int* const ig_upper,
+                   const double* const x_lower,
+                   const double* const dx,
+                   const std::vector<int>& local_indices,
+                   const std::vector<double>& periodic_shifts)
+{
+    static const int W = KernelWeights::WIDTH;
+    int ng[NDIM];
+    int ghost_box_size = 1;
+    double cell_volume = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ng[d] = ig_upper[d] - ig_lower[d] + 1;
+        ghost_box_size *= ng[d];
+        cell_volume *= dx[d];
+    }
+    std::vector<int> order;
+    compute_cell_sorted_ordering(
+        order, W, X, x_lower, dx, ig_lower, ig_upper, ilower, local_indices, periodic_shifts);
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    double w[NDIM][W][WEIGHT_BLOCK_SIZE];
+    int ic_lower[NDIM][WEIGHT_BLOCK_SIZE];
+    for (int k = 0; k < num_local_indices; k += WEIGHT_BLOCK_SIZE)
+    {
+        const int n = std::min(WEIGHT_BLOCK_SIZE, num_local_indices - k);
+        compute_block_weights<KernelWeights>(
+            w, ic_lower, &order[k], n, X, x_lower, dx, ilower, local_indices, periodic_shifts);
+        for (int b = 0; b < n; ++b)
+        {
+            const int s = local_indices[order[k + b]];
+            int istart[NDIM], istop[NDIM];
+            bool interior_stencil = true;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                istart[d] = std::max(ig_lower[d] - ic_lower[d][b], 0);
+                istop[d] = W - 1 - std::max(ic_lower[d][b] + W - 1 - ig_upper[d], 0);
+                interior_stencil = interior_stencil && istart[d] == 0 && istop[d] == W - 1;
+            }
+            const int offset = (ic_lower[0][b] - ig_lower[0]) +
+                               ng[0] * ((ic_lower[1][b] - ig_lower[1])
+#if (NDIM == 3)
+                                        + ng[1] * (ic_lower[2][b] - ig_lower[2])
+#endif
+                                            );
+            for (int depth = 0; depth < q_depth; ++depth)
+            {
+                double* const q_depth_data = q + depth * ghost_box_size + offset;
+                const double V = Q[depth + s * q_depth];
+                if (interior_stencil)
+                {
+#if (NDIM == 3)
+                    for (int i2 = 0; i2 < W; ++i2)
+                    {
+#endif
+                        for (int i1 = 0; i1 < W; ++i1)
+                        {
+#if (NDIM == 2)
+                            const double wy = w[1][i1][b] / cell_volume;
+                            double* const q_row = q_depth_data + ng[0] * i1;
+#endif
+#if (NDIM == 3)
+                            const double wy = w[1][i1][b] * (w[2][i2][b] / cell_volume);
+                            double* const q_row = q_depth_data + ng[0] * (i1 + ng[1] * i2);
+#endif
+                            for (int i0 = 0; i0 < W; ++i0)
+                            {
+                                q_row[i0] += (w[0][i0][b] * wy) * V;
+                            }
+                        }
+#if (NDIM == 3)
+                    }
+#endif
+                }
+                else
+                {
+#if (NDIM == 3)
+                    for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+                    {
+#endif
+                        for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                        {
+#if (NDIM == 2)
+                            const double wy = w[1][i1][b] / cell_volume;
+                            double* const q_row = q_depth_data + ng[0] * i1;
+#endif
+#if (NDIM == 3)
+                            const double wy = w[1][i1][b] * (w[2][i2][b] / cell_volume);
+                            double* const q_row = q_depth_data + ng[0] * (i1 + ng[1] * i2);
+#endif
+                            for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                            {
+                                q_row[i0] += (w[0][i0][b] * wy) * V;
+                            }
+                        }
+#if (NDIM == 3)
+                    }
+#endif
+                }
+            }
+        }
+    }
+    return;
+}
 }
 
 double (*LEInteractor::s_kernel_fcn)(double r) = &ib4_kernel_fcn;
@@ -998,6 +1447,12 @@ LEInteractor::printClassData(std::ostream& os)
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+bool
+LEInteractor::hasCellSortedKernel(const std::string& kernel_fcn)
+{
+    return (kernel_fcn == "IB_4" || kernel_fcn == "IB_4_W8" || kernel_fcn == "BSPLINE_4" || kernel_fcn == "BSPLINE_6");
+}
+
 int
 LEInteractor::getStencilSize(const std::string& kernel_fcn)
 {
@@ -1037,7 +1492,8 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(Q_data);
@@ -1057,7 +1513,8 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                 patch,
                 interp_box,
                 periodic_shift,
-                interp_fcn);
+                interp_fcn,
+                use_cell_sorted_kernels);
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -1072,7 +1529,8 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(Q_data);
@@ -1092,7 +1550,8 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                 patch,
                 interp_box,
                 periodic_shift,
-                interp_fcn);
+                interp_fcn,
+                use_cell_sorted_kernels);
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -1107,7 +1566,8 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
     if (Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
     {
@@ -1133,7 +1593,8 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                 patch,
                 interp_box,
                 periodic_shift,
-                interp_fcn);
+                interp_fcn,
+                use_cell_sorted_kernels);
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -1148,7 +1609,8 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
     if (NDIM != 3 || Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
     {
@@ -1174,7 +1636,8 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                 patch,
                 interp_box,
                 periodic_shift,
-                interp_fcn);
+                interp_fcn,
+                use_cell_sorted_kernels);
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -1191,7 +1654,8 @@ LEInteractor::interpolate(double* const Q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -1239,7 +1703,8 @@ LEInteractor::interpolate(double* const Q_data,
                     patch_touches_upper_physical_bdry,
                     local_indices,
                     periodic_shifts,
-                    interp_fcn);
+                    interp_fcn,
+                    use_cell_sorted_kernels);
     }
     return;
 }
@@ -1255,7 +1720,8 @@ LEInteractor::interpolate(double* const Q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -1309,7 +1775,8 @@ LEInteractor::interpolate(double* const Q_data,
                     patch_touches_upper_physical_bdry,
                     local_indices,
                     periodic_shifts,
-                    interp_fcn);
+                    interp_fcn,
+                    use_cell_sorted_kernels);
     }
     return;
 }
@@ -1325,7 +1792,8 @@ LEInteractor::interpolate(double* const Q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -1393,7 +1861,8 @@ LEInteractor::interpolate(double* const Q_data,
                         local_indices,
                         periodic_shifts,
                         interp_fcn,
-                        axis);
+                        axis,
+                        use_cell_sorted_kernels);
             for (unsigned int k = 0; k < local_indices.size(); ++k)
             {
                 Q_data[NDIM * local_indices[k] + axis] = Q_data_axis[local_indices[k]];
@@ -1414,7 +1883,8 @@ LEInteractor::interpolate(double* const Q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -1485,7 +1955,8 @@ LEInteractor::interpolate(double* const Q_data,
                         local_indices,
                         periodic_shifts,
                         interp_fcn,
-                        axis);
+                        axis,
+                        use_cell_sorted_kernels);
             for (unsigned int k = 0; k < local_indices.size(); ++k)
             {
                 Q_data[NDIM * local_indices[k] + axis] = Q_data_axis[local_indices[k]];
@@ -1503,7 +1974,8 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                           const Pointer<CellData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
     if (Q_data.empty()) return;
     interpolate(&Q_data[0],
@@ -1515,7 +1987,8 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                 q_data,
                 patch,
                 interp_box,
-                interp_fcn);
+                interp_fcn,
+                use_cell_sorted_kernels);
 }
 
 void
@@ -1526,7 +1999,8 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                           const Pointer<NodeData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
     if (Q_data.empty()) return;
     interpolate(&Q_data[0],
@@ -1538,7 +2012,8 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                 q_data,
                 patch,
                 interp_box,
-                interp_fcn);
+                interp_fcn,
+                use_cell_sorted_kernels);
 }
 
 void
@@ -1549,7 +2024,8 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                           const Pointer<SideData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
     if (Q_data.empty()) return;
     interpolate(&Q_data[0],
@@ -1561,7 +2037,8 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                 q_data,
                 patch,
                 interp_box,
-                interp_fcn);
+                interp_fcn,
+                use_cell_sorted_kernels);
 }
 
 void
@@ -1572,7 +2049,8 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                           const Pointer<EdgeData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
     if (Q_data.empty()) return;
     interpolate(&Q_data[0],
@@ -1584,7 +2062,8 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                 q_data,
                 patch,
                 interp_box,
-                interp_fcn);
+                interp_fcn,
+                use_cell_sorted_kernels);
 }
 
 void
@@ -1597,7 +2076,8 @@ LEInteractor::interpolate(double* const Q_data,
                           const Pointer<CellData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -1646,7 +2126,8 @@ LEInteractor::interpolate(double* const Q_data,
                     patch_touches_upper_physical_bdry,
                     local_indices,
                     periodic_shifts,
-                    interp_fcn);
+                    interp_fcn,
+                    use_cell_sorted_kernels);
     }
     return;
 }
@@ -1661,7 +2142,8 @@ LEInteractor::interpolate(double* const Q_data,
                           const Pointer<NodeData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -1716,7 +2198,8 @@ LEInteractor::interpolate(double* const Q_data,
                     patch_touches_upper_physical_bdry,
                     local_indices,
                     periodic_shifts,
-                    interp_fcn);
+                    interp_fcn,
+                    use_cell_sorted_kernels);
     }
     return;
 }
@@ -1731,7 +2214,8 @@ LEInteractor::interpolate(double* const Q_data,
                           const Pointer<SideData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -1800,7 +2284,8 @@ LEInteractor::interpolate(double* const Q_data,
                         local_indices,
                         periodic_shifts,
                         interp_fcn,
-                        axis);
+                        axis,
+                        use_cell_sorted_kernels);
             for (unsigned int k = 0; k < local_indices.size(); ++k)
             {
                 Q_data[NDIM * local_indices[k] + axis] = Q_data_axis[local_indices[k]];
@@ -1820,7 +2305,8 @@ LEInteractor::interpolate(double* const Q_data,
                           const Pointer<EdgeData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+                          const std::string& interp_fcn,
+                          const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -1892,7 +2378,8 @@ LEInteractor::interpolate(double* const Q_data,
                         local_indices,
                         periodic_shifts,
                         interp_fcn,
-                        axis);
+                        axis,
+                        use_cell_sorted_kernels);
             for (unsigned int k = 0; k < local_indices.size(); ++k)
             {
                 Q_data[NDIM * local_indices[k] + axis] = Q_data_axis[local_indices[k]];
@@ -1911,7 +2398,9 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(Q_data);
@@ -1931,7 +2420,9 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
            patch,
            spread_box,
            periodic_shift,
-           spread_fcn);
+           spread_fcn,
+           use_threaded_spreading,
+           use_cell_sorted_kernels);
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -1946,7 +2437,9 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(Q_data);
@@ -1966,7 +2459,9 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
            patch,
            spread_box,
            periodic_shift,
-           spread_fcn);
+           spread_fcn,
+           use_threaded_spreading,
+           use_cell_sorted_kernels);
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -1981,7 +2476,9 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
     if (Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
     {
@@ -2007,7 +2504,9 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
            patch,
            spread_box,
            periodic_shift,
-           spread_fcn);
+           spread_fcn,
+           use_threaded_spreading,
+           use_cell_sorted_kernels);
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -2022,7 +2521,9 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
     if (NDIM != 3 || Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
     {
@@ -2048,7 +2549,9 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
            patch,
            spread_box,
            periodic_shift,
-           spread_fcn);
+           spread_fcn,
+           use_threaded_spreading,
+           use_cell_sorted_kernels);
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -2065,7 +2568,9 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2113,7 +2618,10 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                patch_touches_upper_physical_bdry,
                local_indices,
                periodic_shifts,
-               spread_fcn);
+               spread_fcn,
+               /*axis*/ 0,
+               use_threaded_spreading,
+               use_cell_sorted_kernels);
     }
     return;
 }
@@ -2129,7 +2637,9 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2183,7 +2693,10 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                patch_touches_upper_physical_bdry,
                local_indices,
                periodic_shifts,
-               spread_fcn);
+               spread_fcn,
+               /*axis*/ 0,
+               use_threaded_spreading,
+               use_cell_sorted_kernels);
     }
     return;
 }
@@ -2199,7 +2712,9 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2271,7 +2786,9 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                    local_indices,
                    periodic_shifts,
                    spread_fcn,
-                   axis);
+                   axis,
+                   use_threaded_spreading,
+                   use_cell_sorted_kernels);
         }
     }
     return;
@@ -2288,7 +2805,9 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2363,7 +2882,9 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                    local_indices,
                    periodic_shifts,
                    spread_fcn,
-                   axis);
+                   axis,
+                   use_threaded_spreading,
+                   use_cell_sorted_kernels);
         }
     }
     return;
@@ -2377,7 +2898,9 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& interp_fcn)
+                     const std::string& interp_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
     if (Q_data.empty()) return;
     spread(q_data,
@@ -2389,7 +2912,9 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
            X_depth,
            patch,
            spread_box,
-           interp_fcn);
+           interp_fcn,
+           use_threaded_spreading,
+           use_cell_sorted_kernels);
 }
 
 void
@@ -2400,7 +2925,9 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& interp_fcn)
+                     const std::string& interp_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
     if (Q_data.empty()) return;
     spread(q_data,
@@ -2412,7 +2939,9 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
            X_depth,
            patch,
            spread_box,
-           interp_fcn);
+           interp_fcn,
+           use_threaded_spreading,
+           use_cell_sorted_kernels);
 }
 
 void
@@ -2423,7 +2952,9 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& interp_fcn)
+                     const std::string& interp_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
     if (Q_data.empty()) return;
     spread(q_data,
@@ -2435,7 +2966,9 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
            X_depth,
            patch,
            spread_box,
-           interp_fcn);
+           interp_fcn,
+           use_threaded_spreading,
+           use_cell_sorted_kernels);
 }
 
 void
@@ -2446,7 +2979,9 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& interp_fcn)
+                     const std::string& interp_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
     if (Q_data.empty()) return;
     spread(q_data,
@@ -2458,7 +2993,9 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
            X_depth,
            patch,
            spread_box,
-           interp_fcn);
+           interp_fcn,
+           use_threaded_spreading,
+           use_cell_sorted_kernels);
 }
 
 void
@@ -2471,7 +3008,9 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2520,7 +3059,10 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                patch_touches_upper_physical_bdry,
                local_indices,
                periodic_shifts,
-               spread_fcn);
+               spread_fcn,
+               /*axis*/ 0,
+               use_threaded_spreading,
+               use_cell_sorted_kernels);
     }
     return;
 }
@@ -2535,7 +3077,9 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2590,7 +3134,10 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                patch_touches_upper_physical_bdry,
                local_indices,
                periodic_shifts,
-               spread_fcn);
+               spread_fcn,
+               /*axis*/ 0,
+               use_threaded_spreading,
+               use_cell_sorted_kernels);
     }
     return;
 }
@@ -2605,7 +3152,9 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
     if (Q_depth != NDIM || q_data->getDepth() != 1)
     {
@@ -2673,7 +3222,9 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                    local_indices,
                    periodic_shifts,
                    spread_fcn,
-                   axis);
+                   axis,
+                   use_threaded_spreading,
+                   use_cell_sorted_kernels);
         }
     }
     return;
@@ -2689,7 +3240,9 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
     if (NDIM != 3 || Q_depth != NDIM || q_data->getDepth() != 1)
     {
@@ -2760,7 +3313,9 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                    local_indices,
                    periodic_shifts,
                    spread_fcn,
-                   axis);
+                   axis,
+                   use_threaded_spreading,
+                   use_cell_sorted_kernels);
         }
     }
     return;
@@ -2786,7 +3341,8 @@ LEInteractor::interpolate(double* const Q_data,
                           const std::vector<int>& local_indices,
                           const std::vector<double>& periodic_shifts,
                           const std::string& interp_fcn,
-                          const int axis)
+                          const int axis,
+                          const bool use_cell_sorted_kernels)
 {
     const int stencil_size = getStencilSize(interp_fcn);
     const int min_ghosts = getMinimumGhostWidth(interp_fcn);
@@ -2811,6 +3367,72 @@ LEInteractor::interpolate(double* const Q_data,
     const int local_indices_size = static_cast<int>(local_indices.size());
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
+    if (use_cell_sorted_kernels && hasCellSortedKernel(interp_fcn))
+    {
+        int ig_lower[NDIM], ig_upper[NDIM];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            ig_lower[d] = ilower(d) - q_gcw(d);
+            ig_upper[d] = iupper(d) + q_gcw(d);
+        }
+        if (interp_fcn == "IB_4")
+        {
+            interpolate_cell_sorted<IB4KernelWeights>(Q_data,
+                                                      X_data,
+                                                      q_data,
+                                                      q_depth,
+                                                      ilower,
+                                                      ig_lower,
+                                                      ig_upper,
+                                                      x_lower,
+                                                      dx,
+                                                      local_indices,
+                                                      periodic_shifts);
+        }
+        else if (interp_fcn == "IB_4_W8")
+        {
+            interpolate_cell_sorted<IB4W8KernelWeights>(Q_data,
+                                                        X_data,
+                                                        q_data,
+                                                        q_depth,
+                                                        ilower,
+                                                        ig_lower,
+                                                        ig_upper,
+                                                        x_lower,
+                                                        dx,
+                                                        local_indices,
+                                                        periodic_shifts);
+        }
+        else if (interp_fcn == "BSPLINE_4")
+        {
+            interpolate_cell_sorted<BSpline4KernelWeights>(Q_data,
+                                                           X_data,
+                                                           q_data,
+                                                           q_depth,
+                                                           ilower,
+                                                           ig_lower,
+                                                           ig_upper,
+                                                           x_lower,
+                                                           dx,
+                                                           local_indices,
+                                                           periodic_shifts);
+        }
+        else if (interp_fcn == "BSPLINE_6")
+        {
+            interpolate_cell_sorted<BSpline6KernelWeights>(Q_data,
+                                                           X_data,
+                                                           q_data,
+                                                           q_depth,
+                                                           ilower,
+                                                           ig_lower,
+                                                           ig_upper,
+                                                           x_lower,
+                                                           dx,
+                                                           local_indices,
+                                                           periodic_shifts);
+        }
+        return;
+    }
     if (interp_fcn == "PIECEWISE_CONSTANT")
     {
         LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC(dx,
@@ -3270,7 +3892,9 @@ LEInteractor::spread(double* const q_data,
                      const std::vector<int>& local_indices,
                      const std::vector<double>& periodic_shifts,
                      const std::string& spread_fcn,
-                     const int axis)
+                     const int axis,
+                     const bool use_threaded_spreading,
+                     const bool use_cell_sorted_kernels)
 {
     const int stencil_size = getStencilSize(spread_fcn);
     const int min_ghosts = getMinimumGhostWidth(spread_fcn);
@@ -3297,10 +3921,155 @@ LEInteractor::spread(double* const q_data,
                    << q_gcw_min
                    << "\n");
     }
+    if (local_indices.empty()) return;
+    if (use_threaded_spreading && local_indices.size() > 1)
+    {
+        // Spread the colored batches.  Batches of the same color have
+        // non-overlapping kernel footprints and may be processed concurrently.
+        std::vector<std::vector<std::vector<int> > > batch_local_indices;
+        std::vector<std::vector<std::vector<double> > > batch_periodic_shifts;
+        buildColoredSpreadBatches(batch_local_indices,
+                                  batch_periodic_shifts,
+                                  X_data,
+                                  x_lower,
+                                  dx,
+                                  local_indices,
+                                  periodic_shifts,
+                                  stencil_size);
+        for (unsigned int color = 0; color < batch_local_indices.size(); ++color)
+        {
+            const int num_batches = static_cast<int>(batch_local_indices[color].size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int b = 0; b < num_batches; ++b)
+            {
+                spreadKernel(q_data,
+                             q_data_box,
+                             q_gcw,
+                             q_depth,
+                             Q_data,
+                             Q_depth,
+                             X_data,
+                             x_lower,
+                             x_upper,
+                             dx,
+                             batch_local_indices[color][b],
+                             batch_periodic_shifts[color][b],
+                             spread_fcn,
+                             axis,
+                             use_cell_sorted_kernels);
+            }
+        }
+    }
+    else
+    {
+        spreadKernel(q_data,
+                     q_data_box,
+                     q_gcw,
+                     q_depth,
+                     Q_data,
+                     Q_depth,
+                     X_data,
+                     x_lower,
+                     x_upper,
+                     dx,
+                     local_indices,
+                     periodic_shifts,
+                     spread_fcn,
+                     axis,
+                     use_cell_sorted_kernels);
+    }
+    return;
+}
+
+void
+LEInteractor::spreadKernel(double* const q_data,
+                           const Box<NDIM>& q_data_box,
+                           const IntVector<NDIM>& q_gcw,
+                           const int q_depth,
+                           const double* const Q_data,
+                           const int Q_depth,
+                           const double* const X_data,
+                           const double* const x_lower,
+                           const double* const x_upper,
+                           const double* const dx,
+                           const std::vector<int>& local_indices,
+                           const std::vector<double>& periodic_shifts,
+                           const std::string& spread_fcn,
+                           const int axis,
+                           const bool use_cell_sorted_kernels)
+{
     if (local_indices.empty()) return;
     const int local_indices_size = static_cast<int>(local_indices.size());
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
+    if (use_cell_sorted_kernels && hasCellSortedKernel(spread_fcn))
+    {
+        int ig_lower[NDIM], ig_upper[NDIM];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            ig_lower[d] = ilower(d) - q_gcw(d);
+            ig_upper[d] = iupper(d) + q_gcw(d);
+        }
+        if (spread_fcn == "IB_4")
+        {
+            spread_cell_sorted<IB4KernelWeights>(q_data,
+                                                 Q_data,
+                                                 X_data,
+                                                 q_depth,
+                                                 ilower,
+                                                 ig_lower,
+                                                 ig_upper,
+                                                 x_lower,
+                                                 dx,
+                                                 local_indices,
+                                                 periodic_shifts);
+        }
+        else if (spread_fcn == "IB_4_W8")
+        {
+            spread_cell_sorted<IB4W8KernelWeights>(q_data,
+                                                   Q_data,
+                                                   X_data,
+                                                   q_depth,
+                                                   ilower,
+                                                   ig_lower,
+                                                   ig_upper,
+                                                   x_lower,
+                                                   dx,
+                                                   local_indices,
+                                                   periodic_shifts);
+        }
+        else if (spread_fcn == "BSPLINE_4")
+        {
+            spread_cell_sorted<BSpline4KernelWeights>(q_data,
+                                                      Q_data,
+                                                      X_data,
+                                                      q_depth,
+                                                      ilower,
+                                                      ig_lower,
+                                                      ig_upper,
+                                                      x_lower,
+                                                      dx,
+                                                      local_indices,
+                                                      periodic_shifts);
+        }
+        else if (spread_fcn == "BSPLINE_6")
+        {
+            spread_cell_sorted<BSpline6KernelWeights>(q_data,
+                                                      Q_data,
+                                                      X_data,
+                                                      q_depth,
+                                                      ilower,
+                                                      ig_lower,
+                                                      ig_upper,
+                                                      x_lower,
+                                                      dx,
+                                                      local_indices,
+                                                      periodic_shifts);
+        }
+        return;
+    }
     if (spread_fcn == "PIECEWISE_CONSTANT")
     {
         LAGRANGIAN_PIECEWISE_CONSTANT_SPREAD_FC(dx,
@@ -3744,6 +4513,93 @@ LEInteractor::spread(double* const q_data,
     return;
 }
 
+void
+LEInteractor::buildColoredSpreadBatches(std::vector<std::vector<std::vector<int> > >& batch_local_indices,
+                                        std::vector<std::vector<std::vector<double> > >& batch_periodic_shifts,
+                                        const double* const X_data,
+                                        const double* const x_lower,
+                                        const double* const dx,
+                                        const std::vector<int>& local_indices,
+                                        const std::vector<double>& periodic_shifts,
+                                        const int stencil_size)
+{
+    // The kernel footprint of a marker located in cell i is contained in
+    // [i-stencil_size/2,i+stencil_size/2].  Using tiles that are wider than
+    // the stencil ensures that the footprints of markers in two tiles of the
+    // same color (i.e., tiles separated by at least one other tile along each
+    // axis) are disjoint.
+    const int tile_width = std::max(stencil_size, 1) + 1;
+    static const int num_colors = 1 << NDIM;
+    const int num_local_indices = static_cast<int>(local_indices.size());
+
+    // Determine the tile containing each marker.
+    std::vector<boost::array<int, NDIM> > marker_tile(num_local_indices);
+    boost::array<int, NDIM> tile_lower, tile_upper;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        tile_lower[d] = std::numeric_limits<int>::max();
+        tile_upper[d] = std::numeric_limits<int>::min();
+    }
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int i =
+                static_cast<int>(
+                    std::floor((X_data[d + s * NDIM] + periodic_shifts[d + l * NDIM] - x_lower[d]) / dx[d]));
+            const int t = (i >= 0 ? i / tile_width : -((-i - 1) / tile_width) - 1);
+            marker_tile[l][d] = t;
+            tile_lower[d] = std::min(tile_lower[d], t);
+            tile_upper[d] = std::max(tile_upper[d], t);
+        }
+    }
+
+    // Bin the markers by tile, preserving their relative ordering.
+    int num_tiles = 1;
+    boost::array<int, NDIM> tile_extent;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        tile_extent[d] = tile_upper[d] - tile_lower[d] + 1;
+        num_tiles *= tile_extent[d];
+    }
+    std::vector<std::vector<int> > tile_local_indices(num_tiles);
+    std::vector<std::vector<double> > tile_periodic_shifts(num_tiles);
+    std::vector<int> tile_color(num_tiles, 0);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        int tile_idx = 0, color = 0;
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            const int t = marker_tile[l][d];
+            tile_idx = tile_idx * tile_extent[d] + (t - tile_lower[d]);
+            if ((t % 2 + 2) % 2 == 1) IBTK_BIT_SET(color, d);
+        }
+        tile_color[tile_idx] = color;
+        tile_local_indices[tile_idx].push_back(local_indices[l]);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            tile_periodic_shifts[tile_idx].push_back(periodic_shifts[d + l * NDIM]);
+        }
+    }
+
+    // Group the non-empty tiles by color.
+    batch_local_indices.clear();
+    batch_local_indices.resize(num_colors);
+    batch_periodic_shifts.clear();
+    batch_periodic_shifts.resize(num_colors);
+    for (int tile_idx = 0; tile_idx < num_tiles; ++tile_idx)
+    {
+        if (tile_local_indices[tile_idx].empty()) continue;
+        const int color = tile_color[tile_idx];
+        batch_local_indices[color].push_back(std::vector<int>());
+        batch_local_indices[color].back().swap(tile_local_indices[tile_idx]);
+        batch_periodic_shifts[color].push_back(std::vector<double>());
+        batch_periodic_shifts[color].back().swap(tile_periodic_shifts[tile_idx]);
+    }
+    return;
+}
+
 template <class T>
 void
 LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
@@ -4117,7 +4973,8 @@ template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_dat
                                               const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                               const SAMRAI::hier::Box<NDIM>& interp_box,
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
+                                              const std::string& interp_fcn,
+                                              bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
                                               const SAMRAI::tbox::Pointer<LData> X_data,
@@ -4126,7 +4983,8 @@ template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_dat
                                               const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                               const SAMRAI::hier::Box<NDIM>& interp_box,
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
+                                              const std::string& interp_fcn,
+                                              bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
                                               const SAMRAI::tbox::Pointer<LData> X_data,
@@ -4135,7 +4993,8 @@ template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_dat
                                               const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                               const SAMRAI::hier::Box<NDIM>& interp_box,
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
+                                              const std::string& interp_fcn,
+                                              bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
                                               const SAMRAI::tbox::Pointer<LData> X_data,
@@ -4144,7 +5003,8 @@ template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_dat
                                               const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                               const SAMRAI::hier::Box<NDIM>& interp_box,
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
+                                              const std::string& interp_fcn,
+                                              bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const int Q_depth,
@@ -4155,7 +5015,8 @@ template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                               const SAMRAI::hier::Box<NDIM>& interp_box,
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
+                                              const std::string& interp_fcn,
+                                              bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const int Q_depth,
@@ -4166,7 +5027,8 @@ template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                               const SAMRAI::hier::Box<NDIM>& interp_box,
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
+                                              const std::string& interp_fcn,
+                                              bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const int Q_depth,
@@ -4177,7 +5039,8 @@ template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                               const SAMRAI::hier::Box<NDIM>& interp_box,
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
+                                              const std::string& interp_fcn,
+                                              bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const int Q_depth,
@@ -4188,7 +5051,8 @@ template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                               const SAMRAI::hier::Box<NDIM>& interp_box,
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
+                                              const std::string& interp_fcn,
+                                              bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
                                          const SAMRAI::tbox::Pointer<LData> Q_data,
@@ -4197,7 +5061,9 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Cel
                                          const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                          const SAMRAI::hier::Box<NDIM>& spread_box,
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
+                                         const std::string& spread_fcn,
+                                         bool use_threaded_spreading,
+                                         bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
                                          const SAMRAI::tbox::Pointer<LData> Q_data,
@@ -4206,7 +5072,9 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Nod
                                          const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                          const SAMRAI::hier::Box<NDIM>& spread_box,
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
+                                         const std::string& spread_fcn,
+                                         bool use_threaded_spreading,
+                                         bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
                                          const SAMRAI::tbox::Pointer<LData> Q_data,
@@ -4215,7 +5083,9 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Sid
                                          const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                          const SAMRAI::hier::Box<NDIM>& spread_box,
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
+                                         const std::string& spread_fcn,
+                                         bool use_threaded_spreading,
+                                         bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
                                          const SAMRAI::tbox::Pointer<LData> Q_data,
@@ -4224,7 +5094,9 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Edg
                                          const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                          const SAMRAI::hier::Box<NDIM>& spread_box,
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
+                                         const std::string& spread_fcn,
+                                         bool use_threaded_spreading,
+                                         bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
                                          const double* const Q_data,
@@ -4235,7 +5107,9 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Cel
                                          const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                          const SAMRAI::hier::Box<NDIM>& spread_box,
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
+                                         const std::string& spread_fcn,
+                                         bool use_threaded_spreading,
+                                         bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
                                          const double* const Q_data,
@@ -4246,7 +5120,9 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Nod
                                          const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                          const SAMRAI::hier::Box<NDIM>& spread_box,
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
+                                         const std::string& spread_fcn,
+                                         bool use_threaded_spreading,
+                                         bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
                                          const double* const Q_data,
@@ -4257,7 +5133,9 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Sid
                                          const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                          const SAMRAI::hier::Box<NDIM>& spread_box,
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
+                                         const std::string& spread_fcn,
+                                         bool use_threaded_spreading,
+                                         bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
                                          const double* const Q_data,
@@ -4268,7 +5146,9 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Edg
                                          const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                          const SAMRAI::hier::Box<NDIM>& spread_box,
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
+                                         const std::string& spread_fcn,
+                                         bool use_threaded_spreading,
+                                         bool use_cell_sorted_kernels);
 
 template void IBTK::LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
                                                     std::vector<double>& periodic_shifts,
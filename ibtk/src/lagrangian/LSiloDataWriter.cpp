@@ -89,6 +89,11 @@ static const std::string SILO_SUMMARY_FILE_PREFIX = "lag_data.cycle_";
 static const std::string SILO_SUMMARY_FILE_POSTFIX = ".summary.silo";
 static const std::string SILO_PROCESSOR_FILE_PREFIX = "lag_data.proc_";
 static const std::string SILO_PROCESSOR_FILE_POSTFIX = ".silo";
+static const std::string SILO_PROCESSOR_DIR_PREFIX = "processor_";
+
+// The MPI tag number used to pass the write baton between MPI processes that
+// share a Silo data file.
+static const int SILO_BATON_TAG = 1;
 
 // Version of LSiloDataWriter restart file data.
 static const int LAG_SILO_DATA_WRITER_VERSION = 1;
@@ -645,6 +650,7 @@ LSiloDataWriter::LSiloDataWriter(const std::string& object_name,
     : d_object_name(object_name),
       d_registered_for_restart(register_for_restart),
       d_dump_directory_name(dump_directory_name),
+      d_num_procs_per_file(1),
       d_time_step_number(-1),
       d_hierarchy(),
       d_coarsest_ln(0),
@@ -845,6 +851,22 @@ LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
     return;
 } // resetLevels
 
+void
+LSiloDataWriter::setNumberOfProcessesPerFile(const int num_procs_per_file)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_procs_per_file >= 1);
+#endif
+    d_num_procs_per_file = num_procs_per_file;
+    return;
+} // setNumberOfProcessesPerFile
+
+int
+LSiloDataWriter::getNumberOfProcessesPerFile() const
+{
+    return d_num_procs_per_file;
+} // getNumberOfProcessesPerFile
+
 void
 LSiloDataWriter::registerMarkerCloud(const std::string& name,
                                      const int nmarks,
@@ -1294,67 +1316,120 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
     Utilities::recursiveMkdir(dump_dirname);
 
-    // Create one local DBfile per MPI process.
-    sprintf(temp_buf, "%04d", mpi_rank);
-    current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
-    current_file_name += temp_buf;
-    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-    if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
-    {
-        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                 << "  Could not create DBfile named "
-                                 << current_file_name
-                                 << std::endl);
-    }
-
-    std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
-    std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
-
-    // Set the local data.
+    // Scatter the data from "global" to "local" form.  The scatters are
+    // collective operations, so they must be completed before any MPI process
+    // waits for its turn to write to a shared DBfile.
+    std::vector<Vec> local_X_vecs(d_finest_ln + 1, static_cast<Vec>(NULL));
+    std::vector<std::vector<Vec> > local_v_vecs(d_finest_ln + 1);
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         if (d_coords_data[ln])
         {
-            // Scatter the data from "global" to "local" form.
-            Vec local_X_vec;
-            ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
+            ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vecs[ln]);
             IBTK_CHKERRQ(ierr);
 
             Vec global_X_vec = d_coords_data[ln]->getVec();
-            ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+            ierr = VecScatterBegin(
+                d_vec_scatter[ln][NDIM], global_X_vec, local_X_vecs[ln], INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
-
-            double* local_X_arr;
-            ierr = VecGetArray(local_X_vec, &local_X_arr);
+            ierr = VecScatterEnd(
+                d_vec_scatter[ln][NDIM], global_X_vec, local_X_vecs[ln], INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
 
-            std::vector<Vec> local_v_vecs;
-            std::vector<double*> local_v_arrs;
-
+            local_v_vecs[ln].resize(d_nvars[ln]);
             for (int v = 0; v < d_nvars[ln]; ++v)
             {
                 const int var_depth = d_var_depths[ln][v];
-                Vec local_v_vec;
-                ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
+                ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vecs[ln][v]);
                 IBTK_CHKERRQ(ierr);
 
                 Vec global_v_vec = d_var_data[ln][v]->getVec();
                 ierr = VecScatterBegin(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
+                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vecs[ln][v], INSERT_VALUES, SCATTER_FORWARD);
                 IBTK_CHKERRQ(ierr);
                 ierr = VecScatterEnd(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
+                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vecs[ln][v], INSERT_VALUES, SCATTER_FORWARD);
                 IBTK_CHKERRQ(ierr);
+            }
+        }
+    }
 
-                double* local_v_arr;
-                ierr = VecGetArray(local_v_vec, &local_v_arr);
-                IBTK_CHKERRQ(ierr);
+    // Create or open the local DBfile.  Each group of d_num_procs_per_file MPI
+    // processes shares a single DBfile, and the processes in each group take
+    // turns writing their data to that file.
+    const int file_number = mpi_rank / d_num_procs_per_file;
+    const bool first_proc_in_group = (mpi_rank % d_num_procs_per_file == 0);
+    const bool last_proc_in_group = ((mpi_rank + 1) % d_num_procs_per_file == 0) || (mpi_rank == mpi_nodes - 1);
+    int flag = 1;
+    int sz = 1;
+
+    sprintf(temp_buf, "%04d", file_number);
+    current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
+    current_file_name += temp_buf;
+    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+
+    if (first_proc_in_group)
+    {
+        if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not create DBfile named "
+                                     << current_file_name
+                                     << std::endl);
+        }
+    }
+    else
+    {
+        // Wait for the previous MPI process to finish writing to the DBfile.
+        SAMRAI_MPI::recv(&flag, sz, mpi_rank - 1, false, SILO_BATON_TAG);
+        if (!(dbfile = DBOpen(current_file_name.c_str(), DB_PDB, DB_APPEND)))
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not open DBfile named "
+                                     << current_file_name
+                                     << std::endl);
+        }
+    }
 
-                local_v_vecs.push_back(local_v_vec);
-                local_v_arrs.push_back(local_v_arr);
+    // When the DBfile is shared, the local data is written to a separate
+    // directory for each MPI process.
+    if (d_num_procs_per_file > 1)
+    {
+        sprintf(temp_buf, "%04d", mpi_rank);
+        std::string proc_dirname = SILO_PROCESSOR_DIR_PREFIX + temp_buf;
+        if (DBMkDir(dbfile, proc_dirname.c_str()) == -1)
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not create directory named "
+                                     << proc_dirname
+                                     << std::endl);
+        }
+        if (DBSetDir(dbfile, proc_dirname.c_str()) == -1)
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not set directory "
+                                     << proc_dirname
+                                     << std::endl);
+        }
+    }
+
+    std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
+    std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
+
+    // Set the local data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (d_coords_data[ln])
+        {
+            double* local_X_arr;
+            ierr = VecGetArray(local_X_vecs[ln], &local_X_arr);
+            IBTK_CHKERRQ(ierr);
+
+            std::vector<double*> local_v_arrs(d_nvars[ln]);
+            for (int v = 0; v < d_nvars[ln]; ++v)
+            {
+                ierr = VecGetArray(local_v_vecs[ln][v], &local_v_arrs[v]);
+                IBTK_CHKERRQ(ierr);
             }
 
             // Keep track of the current offset in the local Vec data.
@@ -1538,16 +1613,11 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                 offset += ntot;
             }
 
-            // Clean up allocated data.
-            ierr = VecRestoreArray(local_X_vec, &local_X_arr);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecDestroy(&local_X_vec);
+            ierr = VecRestoreArray(local_X_vecs[ln], &local_X_arr);
             IBTK_CHKERRQ(ierr);
             for (int v = 0; v < d_nvars[ln]; ++v)
             {
-                ierr = VecRestoreArray(local_v_vecs[v], &local_v_arrs[v]);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecDestroy(&local_v_vecs[v]);
+                ierr = VecRestoreArray(local_v_vecs[ln][v], &local_v_arrs[v]);
                 IBTK_CHKERRQ(ierr);
             }
         }
@@ -1555,6 +1625,24 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
     DBClose(dbfile);
 
+    // Free the next MPI process in the group to start writing to the DBfile.
+    if (!last_proc_in_group) SAMRAI_MPI::send(&flag, sz, mpi_rank + 1, false, SILO_BATON_TAG);
+
+    // Clean up allocated data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (d_coords_data[ln])
+        {
+            ierr = VecDestroy(&local_X_vecs[ln]);
+            IBTK_CHKERRQ(ierr);
+            for (int v = 0; v < d_nvars[ln]; ++v)
+            {
+                ierr = VecDestroy(&local_v_vecs[ln][v]);
+                IBTK_CHKERRQ(ierr);
+            }
+        }
+    }
+
     // Send data to the root MPI process required to create the multimesh and
     // multivar objects.
     std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
@@ -1839,19 +1927,27 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
         DBAddOption(optlist, DBOPT_TIME, &time);
         DBAddOption(optlist, DBOPT_DTIME, &dtime);
 
+        // Determine the location of the local data written by each MPI process.
+        std::vector<std::string> proc_data_path(mpi_nodes);
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            sprintf(temp_buf, "%04d", proc / d_num_procs_per_file);
+            proc_data_path[proc] = SILO_PROCESSOR_FILE_PREFIX + temp_buf + SILO_PROCESSOR_FILE_POSTFIX + ":";
+            if (d_num_procs_per_file > 1)
+            {
+                sprintf(temp_buf, "%04d", proc);
+                proc_data_path[proc] += SILO_PROCESSOR_DIR_PREFIX + temp_buf + "/";
+            }
+        }
+
         for (int proc = 0; proc < mpi_nodes; ++proc)
         {
             for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
             {
                 for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
                 {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                     std::ostringstream stream;
-                    stream << current_file_name << ":level_" << ln << "_cloud_" << cloud << "/mesh";
+                    stream << proc_data_path[proc] << "level_" << ln << "_cloud_" << cloud << "/mesh";
                     std::string meshname = stream.str();
                     char* meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = DB_POINTMESH;
@@ -1871,13 +1967,8 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                 for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
                 {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                     std::ostringstream stream;
-                    stream << current_file_name << ":level_" << ln << "_block_" << block << "/mesh";
+                    stream << proc_data_path[proc] << "level_" << ln << "_block_" << block << "/mesh";
                     std::string meshname = stream.str();
                     char* meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = meshtypes_per_proc[ln][proc][block];
@@ -1897,18 +1988,14 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                 for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                 {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                     const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
                     char** meshnames = new char*[nblocks];
 
                     for (int block = 0; block < nblocks; ++block)
                     {
                         std::ostringstream stream;
-                        stream << current_file_name << ":level_" << ln << "_mb_" << mb << "_block_" << block << "/mesh";
+                        stream << proc_data_path[proc] << "level_" << ln << "_mb_" << mb << "_block_" << block
+                               << "/mesh";
                         meshnames[block] = strdup(stream.str().c_str());
                     }
 
@@ -1938,13 +2025,8 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                 for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
                 {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                     std::ostringstream stream;
-                    stream << current_file_name << ":level_" << ln << "_mesh_" << mesh << "/mesh";
+                    stream << proc_data_path[proc] << "level_" << ln << "_mesh_" << mesh << "/mesh";
                     std::string meshname = stream.str();
                     char* meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = DB_UCDMESH;
@@ -1966,13 +2048,8 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                 {
                     for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
                     {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                         std::ostringstream varname_stream;
-                        varname_stream << current_file_name << ":level_" << ln << "_cloud_" << cloud << "/"
+                        varname_stream << proc_data_path[proc] << "level_" << ln << "_cloud_" << cloud << "/"
                                        << d_var_names[ln][v];
                         std::string varname = varname_stream.str();
                         char* varname_ptr = const_cast<char*>(varname.c_str());
@@ -1989,13 +2066,8 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
                     {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                         std::ostringstream varname_stream;
-                        varname_stream << current_file_name << ":level_" << ln << "_block_" << block << "/"
+                        varname_stream << proc_data_path[proc] << "level_" << ln << "_block_" << block << "/"
                                        << d_var_names[ln][v];
                         std::string varname = varname_stream.str();
                         char* varname_ptr = const_cast<char*>(varname.c_str());
@@ -2012,19 +2084,14 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                     {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                         const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
                         char** varnames = new char*[nblocks];
 
                         for (int block = 0; block < nblocks; ++block)
                         {
                             std::ostringstream varname_stream;
-                            varname_stream << current_file_name << ":level_" << ln << "_mb_" << mb << "_block_" << block
-                                           << d_var_names[ln][v];
+                            varname_stream << proc_data_path[proc] << "level_" << ln << "_mb_" << mb << "_block_"
+                                           << block << d_var_names[ln][v];
                             varnames[block] = strdup(varname_stream.str().c_str());
                         }
 
@@ -2050,13 +2117,8 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
                     {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                         std::ostringstream varname_stream;
-                        varname_stream << current_file_name << ":level_" << ln << "_mesh_" << mesh << "/"
+                        varname_stream << proc_data_path[proc] << "level_" << ln << "_mesh_" << mesh << "/"
                                        << d_var_names[ln][v];
                         std::string varname = varname_stream.str();
                         char* varname_ptr = const_cast<char*>(varname.c_str());
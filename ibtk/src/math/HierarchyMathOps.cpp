@@ -99,6 +99,8 @@
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 // FORTRAN ROUTINES
@@ -142,13 +144,52 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Timers.
+static Timer* t_curl;
+static Timer* t_div;
+static Timer* t_grad;
+static Timer* t_interp;
+static Timer* t_laplace;
+static Timer* t_vc_laplace;
+static Timer* t_pointwise_multiply;
+static Timer* t_pointwise_norm;
+}
+
+// Loop over the local patches of a level, distributing the patches among
+// d_num_threads OpenMP threads and timing the loop with the specified timer.
+// The loop body is a block placed between the two macros, in which the current
+// patch is named by the second argument of HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN.
+#if defined(_OPENMP)
+#define HIER_MATH_OPS_PARALLEL_FOR _Pragma("omp parallel for num_threads(d_num_threads) schedule(dynamic)")
+#else
+#define HIER_MATH_OPS_PARALLEL_FOR
+#endif
+
+#define HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, timer)                                                      \
+    IBTK_TIMER_START(timer);                                                                                           \
+    {                                                                                                                  \
+        const Array<int>& local_patch_nums_ = (level)->getProcessorMapping().getLocalIndices();                        \
+        const int num_local_patches_ = local_patch_nums_.getSize();                                                    \
+        HIER_MATH_OPS_PARALLEL_FOR                                                                                     \
+        for (int k_ = 0; k_ < num_local_patches_; ++k_)                                                                \
+        {                                                                                                              \
+            Pointer<Patch<NDIM> > patch = (level)->getPatch(local_patch_nums_[k_]);
+
+#define HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(timer)                                                                      \
+        }                                                                                                              \
+    }                                                                                                                  \
+    IBTK_TIMER_STOP(timer);
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 HierarchyMathOps::HierarchyMathOps(const std::string& name,
                                    Pointer<PatchHierarchy<NDIM> > hierarchy,
                                    const int coarsest_ln,
                                    const int finest_ln,
-                                   const std::string& coarsen_op_name)
+                                   const std::string& coarsen_op_name,
+                                   const int num_threads)
     : d_object_name(name),
       d_hierarchy(),
       d_grid_geom(),
@@ -183,8 +224,12 @@ HierarchyMathOps::HierarchyMathOps(const std::string& name,
       d_using_wgt_cc(false),
       d_using_wgt_fc(false),
       d_using_wgt_sc(false),
-      d_volume(0.0)
+      d_volume(0.0),
+      d_num_threads(num_threads)
 {
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_threads >= 1);
+#endif
     // Setup scratch variables.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     d_context = var_db->getContext(d_object_name + "::CONTEXT");
@@ -287,6 +332,17 @@ HierarchyMathOps::HierarchyMathOps(const std::string& name,
     {
         resetLevels(coarsest_ln, finest_ln);
     }
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_curl = TimerManager::getManager()->getTimer("IBTK::HierarchyMathOps::curl()");
+                 t_div = TimerManager::getManager()->getTimer("IBTK::HierarchyMathOps::div()");
+                 t_grad = TimerManager::getManager()->getTimer("IBTK::HierarchyMathOps::grad()");
+                 t_interp = TimerManager::getManager()->getTimer("IBTK::HierarchyMathOps::interp()");
+                 t_laplace = TimerManager::getManager()->getTimer("IBTK::HierarchyMathOps::laplace()");
+                 t_vc_laplace = TimerManager::getManager()->getTimer("IBTK::HierarchyMathOps::vc_laplace()");
+                 t_pointwise_multiply =
+                     TimerManager::getManager()->getTimer("IBTK::HierarchyMathOps::pointwiseMultiply()");
+                 t_pointwise_norm = TimerManager::getManager()->getTimer("IBTK::HierarchyMathOps::pointwiseNorm()"););
     return;
 } // HierarchyMathOps
 
@@ -296,6 +352,22 @@ HierarchyMathOps::~HierarchyMathOps()
     return;
 } // ~HierarchyMathOps
 
+void
+HierarchyMathOps::setNumberOfThreads(const int num_threads)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_threads >= 1);
+#endif
+    d_num_threads = num_threads;
+    return;
+} // setNumberOfThreads
+
+int
+HierarchyMathOps::getNumberOfThreads() const
+{
+    return d_num_threads;
+} // getNumberOfThreads
+
 void
 HierarchyMathOps::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
 {
@@ -439,15 +511,14 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_curl)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_curl)
     }
     else
     {
@@ -477,10 +548,8 @@ HierarchyMathOps::curl(const int dst_idx,
             {
                 Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_curl)
                 {
-                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
                     Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
                     Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(d_sc_idx);
 #if (NDIM == 2)
@@ -597,6 +666,7 @@ HierarchyMathOps::curl(const int dst_idx,
                                              patch_box.upper(2));
 #endif
                 }
+                HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_curl)
             }
         }
 
@@ -623,15 +693,14 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_curl)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_curl)
     }
     return;
 } // curl
@@ -651,15 +720,14 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_curl)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_curl)
     }
     return;
 } // curl
@@ -679,15 +747,14 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_curl)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_curl)
     }
     return;
 } // curl
@@ -707,15 +774,14 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_curl)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_curl)
     }
     return;
 } // curl
@@ -740,15 +806,14 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_curl)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_curl)
     }
     return;
 } // curl
@@ -773,15 +838,14 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_curl)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_curl)
     }
     return;
 } // curl
@@ -975,10 +1039,8 @@ HierarchyMathOps::div(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete divergence.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_div)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -986,6 +1048,7 @@ HierarchyMathOps::div(const int dst_idx,
 
             d_patch_math_ops.div(dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src2_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_div)
     }
     else
     {
@@ -1055,10 +1118,8 @@ HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_div)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -1072,6 +1133,7 @@ HierarchyMathOps::div(const int dst_idx,
                 of_data->copy(*src1_data);
             }
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_div)
 
         // Synchronize the coarse-fine interface of src1 and deallocate
         // temporary data.
@@ -1113,10 +1175,8 @@ HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_div)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -1130,6 +1190,7 @@ HierarchyMathOps::div(const int dst_idx,
                 os_data->copy(*src1_data);
             }
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_div)
 
         // Synchronize the coarse-fine interface of src1 and deallocate
         // temporary data.
@@ -1163,10 +1224,8 @@ HierarchyMathOps::grad(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete gradient.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_grad)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -1174,6 +1233,7 @@ HierarchyMathOps::grad(const int dst_idx,
 
             d_patch_math_ops.grad(dst_data, alpha, src1_data, beta, src2_data, patch, src1_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_grad)
     }
     else
     {
@@ -1276,10 +1336,8 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_grad)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<FaceData<NDIM, double> > src2_data =
@@ -1293,6 +1351,7 @@ HierarchyMathOps::grad(const int dst_idx,
                 of_data->copy(*dst_data);
             }
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_grad)
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1335,10 +1394,8 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_grad)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -1352,6 +1409,7 @@ HierarchyMathOps::grad(const int dst_idx,
                 os_data->copy(*dst_data);
             }
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_grad)
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1569,10 +1627,8 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_grad)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<FaceData<NDIM, double> > src2_data =
@@ -1623,6 +1679,7 @@ HierarchyMathOps::grad(const int dst_idx,
                 of_data->copy(*dst_data);
             }
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_grad)
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1666,10 +1723,8 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_grad)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -1720,6 +1775,7 @@ HierarchyMathOps::grad(const int dst_idx,
                 os_data->copy(*dst_data);
             }
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_grad)
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1756,10 +1812,8 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_interp)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1771,6 +1825,7 @@ HierarchyMathOps::interp(const int dst_idx,
                 of_data->copy(*src_data);
             }
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_interp)
 
         // Synchronize the coarse-fine interface and deallocate temporary data.
         if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
@@ -1804,10 +1859,8 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_interp)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1819,6 +1872,7 @@ HierarchyMathOps::interp(const int dst_idx,
                 os_data->copy(*src_data);
             }
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_interp)
 
         // Synchronize the coarse-fine interface and deallocate temporary data.
         if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
@@ -1852,10 +1906,8 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_interp)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1867,6 +1919,7 @@ HierarchyMathOps::interp(const int dst_idx,
                 of_data->copy(*dst_data);
             }
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_interp)
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1903,10 +1956,8 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_interp)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1918,6 +1969,7 @@ HierarchyMathOps::interp(const int dst_idx,
                 os_data->copy(*dst_data);
             }
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_interp)
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1994,10 +2046,8 @@ HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete Laplacian.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_laplace)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -2006,6 +2056,7 @@ HierarchyMathOps::laplace(const int dst_idx,
             d_patch_math_ops.laplace(
                 dst_data, alpha, beta, src1_data, gamma, src2_data, patch, dst_depth, src1_depth, src2_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_laplace)
     }
     else
     {
@@ -2228,10 +2279,8 @@ HierarchyMathOps::laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_laplace)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -2239,6 +2288,7 @@ HierarchyMathOps::laplace(const int dst_idx,
 
             d_patch_math_ops.laplace(dst_data, alpha, beta, src1_data, gamma, src2_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_laplace)
     }
 
     // Allocate temporary data.
@@ -2254,14 +2304,13 @@ HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_laplace)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
             os_data->copy(*dst_data);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_laplace)
 
         // Synchronize the coarse-fine interface of dst.
         xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
@@ -2317,10 +2366,8 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_vc_laplace)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > coef_data = patch->getPatchData(coef_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2329,6 +2376,7 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
 
             d_patch_math_ops.vc_laplace(dst_data, alpha, beta, coef_data, src1_data, gamma, src2_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_vc_laplace)
     }
 
     // Allocate temporary data.
@@ -2344,14 +2392,13 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_vc_laplace)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
             os_data->copy(*dst_data);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_vc_laplace)
 
         // Synchronize the coarse-fine interface of dst.
         xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
@@ -2383,10 +2430,8 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_multiply)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -2395,6 +2440,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
             d_patch_math_ops.pointwiseMultiply(
                 dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src1_depth, src2_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_multiply)
     }
     return;
 } // pointwiseMultiply
@@ -2418,10 +2464,8 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_multiply)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -2439,6 +2483,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                src2_depth,
                                                alpha_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_multiply)
     }
     return;
 } // pointwiseMultiply
@@ -2464,10 +2509,8 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_multiply)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -2487,6 +2530,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                alpha_depth,
                                                beta_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_multiply)
     }
     return;
 } // pointwiseMultiply
@@ -2508,10 +2552,8 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_multiply)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<FaceData<NDIM, double> > src2_data =
@@ -2520,6 +2562,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
             d_patch_math_ops.pointwiseMultiply(
                 dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src1_depth, src2_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_multiply)
     }
     return;
 } // pointwiseMultiply
@@ -2543,10 +2586,8 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_multiply)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<FaceData<NDIM, double> > src2_data =
@@ -2564,6 +2605,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                src2_depth,
                                                alpha_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_multiply)
     }
     return;
 } // pointwiseMultiply
@@ -2589,10 +2631,8 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_multiply)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<FaceData<NDIM, double> > src2_data =
@@ -2612,6 +2652,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                alpha_depth,
                                                beta_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_multiply)
     }
     return;
 } // pointwiseMultiply
@@ -2633,10 +2674,8 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_multiply)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<NodeData<NDIM, double> > src2_data =
@@ -2645,6 +2684,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
             d_patch_math_ops.pointwiseMultiply(
                 dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src1_depth, src2_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_multiply)
     }
     return;
 } // pointwiseMultiply
@@ -2668,10 +2708,8 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_multiply)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<NodeData<NDIM, double> > src2_data =
@@ -2689,6 +2727,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                src2_depth,
                                                alpha_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_multiply)
     }
     return;
 } // pointwiseMultiply
@@ -2714,10 +2753,8 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_multiply)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<NodeData<NDIM, double> > src2_data =
@@ -2737,6 +2774,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                alpha_depth,
                                                beta_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_multiply)
     }
     return;
 } // pointwiseMultiply
@@ -2758,10 +2796,8 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_multiply)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -2770,6 +2806,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
             d_patch_math_ops.pointwiseMultiply(
                 dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src1_depth, src2_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_multiply)
     }
     return;
 } // pointwiseMultiply
@@ -2793,10 +2830,8 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_multiply)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -2814,6 +2849,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                src2_depth,
                                                alpha_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_multiply)
     }
     return;
 } // pointwiseMultiply
@@ -2839,10 +2875,8 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_multiply)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -2862,6 +2896,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                alpha_depth,
                                                beta_depth);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_multiply)
     }
     return;
 } // pointwiseMultiply
@@ -2876,15 +2911,14 @@ HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_norm)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.pointwiseL1Norm(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_norm)
     }
     return;
 } // pointwiseL1Norm
@@ -2899,15 +2933,14 @@ HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_norm)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.pointwiseL2Norm(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_norm)
     }
     return;
 } // pointwiseL2Norm
@@ -2922,15 +2955,14 @@ HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_norm)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.pointwiseMaxNorm(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_norm)
     }
     return;
 } // pointwiseMaxNorm
@@ -2945,15 +2977,14 @@ HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_norm)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.pointwiseL1Norm(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_norm)
     }
     return;
 } // pointwiseL1Norm
@@ -2968,15 +2999,14 @@ HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_norm)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.pointwiseL2Norm(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_norm)
     }
     return;
 } // pointwiseL2Norm
@@ -2991,15 +3021,14 @@ HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_BEGIN(level, patch, t_pointwise_norm)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.pointwiseMaxNorm(dst_data, src_data, patch);
         }
+        HIER_MATH_OPS_LOCAL_PATCH_LOOP_END(t_pointwise_norm)
     }
     return;
 } // pointwiseMaxNorm
@@ -304,6 +304,9 @@ PETScVecUtilities::copyToPatchLevelVec_cell(Vec& vec,
     int i_lower, i_upper;
     ierr = VecGetOwnershipRange(vec, &i_lower, &i_upper);
     IBTK_CHKERRQ(ierr);
+    PetscScalar* array;
+    ierr = VecGetArray(vec, &array);
+    IBTK_CHKERRQ(ierr);
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
@@ -322,15 +325,12 @@ PETScVecUtilities::copyToPatchLevelVec_cell(Vec& vec,
                 const int dof_index = (*dof_index_data)(i, d);
                 if (LIKELY(i_lower <= dof_index && dof_index < i_upper))
                 {
-                    ierr = VecSetValues(vec, 1, &dof_index, &(*data)(i, d), INSERT_VALUES);
-                    IBTK_CHKERRQ(ierr);
+                    array[dof_index - i_lower] = (*data)(i, d);
                 }
             }
         }
     }
-    ierr = VecAssemblyBegin(vec);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(vec);
+    ierr = VecRestoreArray(vec, &array);
     IBTK_CHKERRQ(ierr);
     return;
 } // copyToPatchLevelVec_cell
@@ -345,6 +345,9 @@ PETScVecUtilities::copyToPatchLevelVec_side(Vec& vec,
     int i_lower, i_upper;
     ierr = VecGetOwnershipRange(vec, &i_lower, &i_upper);
     IBTK_CHKERRQ(ierr);
+    PetscScalar* array;
+    ierr = VecGetArray(vec, &array);
+    IBTK_CHKERRQ(ierr);
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
@@ -365,16 +368,13 @@ PETScVecUtilities::copyToPatchLevelVec_side(Vec& vec,
                     const int dof_index = (*dof_index_data)(i, d);
                     if (LIKELY(i_lower <= dof_index && dof_index < i_upper))
                     {
-                        ierr = VecSetValues(vec, 1, &dof_index, &(*data)(i, d), INSERT_VALUES);
-                        IBTK_CHKERRQ(ierr);
+                        array[dof_index - i_lower] = (*data)(i, d);
                     }
                 }
             }
         }
     }
-    ierr = VecAssemblyBegin(vec);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(vec);
+    ierr = VecRestoreArray(vec, &array);
     IBTK_CHKERRQ(ierr);
     return;
 } // copyToPatchLevelVec_side
@@ -389,6 +389,9 @@ PETScVecUtilities::copyFromPatchLevelVec_cell(Vec& vec,
     int i_lower, i_upper;
     ierr = VecGetOwnershipRange(vec, &i_lower, &i_upper);
     IBTK_CHKERRQ(ierr);
+    const PetscScalar* array;
+    ierr = VecGetArrayRead(vec, &array);
+    IBTK_CHKERRQ(ierr);
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
@@ -407,12 +410,13 @@ PETScVecUtilities::copyFromPatchLevelVec_cell(Vec& vec,
                 const int dof_index = (*dof_index_data)(i, d);
                 if (LIKELY(i_lower <= dof_index && dof_index < i_upper))
                 {
-                    ierr = VecGetValues(vec, 1, &dof_index, &(*data)(i, d));
-                    IBTK_CHKERRQ(ierr);
+                    (*data)(i, d) = array[dof_index - i_lower];
                 }
             }
         }
     }
+    ierr = VecRestoreArrayRead(vec, &array);
+    IBTK_CHKERRQ(ierr);
     return;
 } // copyFromPatchLevelVec_cell
 
@@ -426,6 +430,9 @@ PETScVecUtilities::copyFromPatchLevelVec_side(Vec& vec,
     int i_lower, i_upper;
     ierr = VecGetOwnershipRange(vec, &i_lower, &i_upper);
     IBTK_CHKERRQ(ierr);
+    const PetscScalar* array;
+    ierr = VecGetArrayRead(vec, &array);
+    IBTK_CHKERRQ(ierr);
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
@@ -446,13 +453,14 @@ PETScVecUtilities::copyFromPatchLevelVec_side(Vec& vec,
                     const int dof_index = (*dof_index_data)(i, d);
                     if (LIKELY(i_lower <= dof_index && dof_index < i_upper))
                     {
-                        ierr = VecGetValues(vec, 1, &dof_index, &(*data)(i, d));
-                        IBTK_CHKERRQ(ierr);
+                        (*data)(i, d) = array[dof_index - i_lower];
                     }
                 }
             }
         }
     }
+    ierr = VecRestoreArrayRead(vec, &array);
+    IBTK_CHKERRQ(ierr);
     return;
 } // copyFromPatchLevelVec_side
 
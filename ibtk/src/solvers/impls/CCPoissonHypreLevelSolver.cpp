@@ -89,6 +89,7 @@ static Timer* t_solve_system;
 static Timer* t_solve_system_hypre;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+static Timer* t_update_poisson_specifications;
 
 // hypre solver options.
 enum HypreStructRAPType
@@ -212,7 +213,9 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
                  t_initialize_solver_state =
                      TimerManager::getManager()->getTimer("IBTK::CCPoissonHypreLevelSolver::initializeSolverState()");
                  t_deallocate_solver_state =
-                     TimerManager::getManager()->getTimer("IBTK::CCPoissonHypreLevelSolver::deallocateSolverState()"););
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonHypreLevelSolver::deallocateSolverState()");
+                 t_update_poisson_specifications = TimerManager::getManager()->getTimer(
+                     "IBTK::CCPoissonHypreLevelSolver::updatePoissonSpecifications()"););
     return;
 } // CCPoissonHypreLevelSolver
 
@@ -396,6 +399,45 @@ CCPoissonHypreLevelSolver::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+CCPoissonHypreLevelSolver::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    setPoissonSpecifications(poisson_spec);
+    if (!d_is_initialized) return false;
+
+    // The hypre grid and stencil depend only on whether the anisotropy is
+    // grid-aligned.
+    bool grid_aligned_anisotropy = true;
+    if (!d_poisson_spec.dIsConstant())
+    {
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<SideDataFactory<NDIM, double> > pdat_factory =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_poisson_spec.getDPatchDataId());
+#if !defined(NDEBUG)
+        TBOX_ASSERT(pdat_factory);
+#endif
+        grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+    }
+    if (grid_aligned_anisotropy != d_grid_aligned_anisotropy) return false;
+
+    IBTK_TIMER_START(t_update_poisson_specifications);
+
+    // Reset the matrix coefficients and rebuild the hypre solver.
+    destroyHypreSolver();
+    if (d_grid_aligned_anisotropy)
+    {
+        setMatrixCoefficients_aligned();
+    }
+    else
+    {
+        setMatrixCoefficients_nonaligned();
+    }
+    setupHypreSolver();
+
+    IBTK_TIMER_STOP(t_update_poisson_specifications);
+    return true;
+} // updatePoissonSpecifications
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -1220,23 +1262,17 @@ CCPoissonHypreLevelSolver::copyToHypre(const std::vector<HYPRE_StructVector>& ve
                                        const CellData<NDIM, double>& src_data,
                                        const Box<NDIM>& box)
 {
+    // Values are read directly from the (possibly ghosted) patch data array;
+    // hypre uses the data box to compute the strides into that array.
     Index<NDIM> lower = box.lower();
     Index<NDIM> upper = box.upper();
-    if (src_data.getGhostBox() == box)
-    {
-        for (unsigned int k = 0; k < d_depth; ++k)
-        {
-            HYPRE_StructVectorSetBoxValues(vectors[k], lower, upper, const_cast<double*>(src_data.getPointer(k)));
-        }
-    }
-    else
+    const Box<NDIM>& data_box = src_data.getGhostBox();
+    Index<NDIM> data_lower = data_box.lower();
+    Index<NDIM> data_upper = data_box.upper();
+    for (unsigned int k = 0; k < d_depth; ++k)
     {
-        CellData<NDIM, double> hypre_data(box, 1, 0);
-        for (unsigned int k = 0; k < d_depth; ++k)
-        {
-            hypre_data.copyDepth(0, src_data, k);
-            HYPRE_StructVectorSetBoxValues(vectors[k], lower, upper, hypre_data.getPointer());
-        }
+        HYPRE_StructVectorSetBoxValues2(
+            vectors[k], lower, upper, data_lower, data_upper, const_cast<double*>(src_data.getPointer(k)));
     }
     return;
 } // copyToHypre
@@ -1248,21 +1284,12 @@ CCPoissonHypreLevelSolver::copyFromHypre(CellData<NDIM, double>& dst_data,
 {
     Index<NDIM> lower = box.lower();
     Index<NDIM> upper = box.upper();
-    if (dst_data.getGhostBox() == box)
-    {
-        for (unsigned int k = 0; k < d_depth; ++k)
-        {
-            HYPRE_StructVectorGetBoxValues(vectors[k], lower, upper, dst_data.getPointer(k));
-        }
-    }
-    else
+    const Box<NDIM>& data_box = dst_data.getGhostBox();
+    Index<NDIM> data_lower = data_box.lower();
+    Index<NDIM> data_upper = data_box.upper();
+    for (unsigned int k = 0; k < d_depth; ++k)
     {
-        CellData<NDIM, double> hypre_data(box, 1, 0);
-        for (unsigned int k = 0; k < d_depth; ++k)
-        {
-            HYPRE_StructVectorGetBoxValues(vectors[k], lower, upper, hypre_data.getPointer());
-            dst_data.copyDepth(k, hypre_data, 0);
-        }
+        HYPRE_StructVectorGetBoxValues2(vectors[k], lower, upper, data_lower, data_upper, dst_data.getPointer(k));
     }
     return;
 } // copyFromHypre
@@ -253,6 +253,23 @@ CCPoissonLevelRelaxationFACOperator::setCoarseSolverType(const std::string& coar
     return;
 }
 
+bool
+CCPoissonLevelRelaxationFACOperator::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    // The ghost cell fill pattern depends on whether the coefficients are
+    // constant, but not on their values.
+    const bool reinit_required = !d_is_initialized || d_poisson_spec.dIsConstant() != poisson_spec.dIsConstant();
+    setPoissonSpecifications(poisson_spec);
+    if (reinit_required) return false;
+    bool updated = true;
+    for (int ln = std::max(1, d_coarsest_ln); ln <= d_finest_ln; ++ln)
+    {
+        if (d_level_solvers[ln]) updated = d_level_solvers[ln]->updatePoissonSpecifications(d_poisson_spec) && updated;
+    }
+    if (d_coarse_solver) updated = d_coarse_solver->updatePoissonSpecifications(d_poisson_spec) && updated;
+    return updated;
+} // updatePoissonSpecifications
+
 void
 CCPoissonLevelRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>& error,
                                                  const SAMRAIVectorReal<NDIM, double>& residual,
@@ -151,8 +151,6 @@ FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorRe
         TBOX_ASSERT(d_f);
         TBOX_ASSERT(d_r);
 #endif
-        d_f->allocateVectorData();
-        d_r->allocateVectorData();
         d_f->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&f, false), false);
         d_r->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&f, false), false);
         switch (d_cycle_type)
@@ -176,8 +174,6 @@ FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorRe
                                      << "."
                                      << std::endl);
         }
-        d_f->deallocateVectorData();
-        d_r->deallocateVectorData();
     }
 
     // Deallocate scratch data.
@@ -210,11 +206,15 @@ FACPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& s
 #endif
     d_fac_strategy->initializeOperatorState(solution, rhs);
 
-    // Create temporary vectors.
+    // Create and allocate temporary vectors.  The vector data is retained
+    // until the solver state is deallocated, so that repeated applications of
+    // the preconditioner do not reallocate it.
     if (!(d_cycle_type == V_CYCLE && d_num_pre_sweeps == 0))
     {
         d_f = rhs.cloneVector("");
         d_r = rhs.cloneVector("");
+        d_f->allocateVectorData();
+        d_r->allocateVectorData();
     }
 
     // Indicate the operator is initialized.
@@ -227,15 +227,17 @@ FACPreconditioner::deallocateSolverState()
 {
     if (!d_is_initialized) return;
 
-    // Destroy temporary vectors.
+    // Deallocate and destroy temporary vectors.
     if (d_f)
     {
+        d_f->deallocateVectorData();
         d_f->freeVectorComponents();
         d_f.setNull();
     }
 
     if (d_r)
     {
+        d_r->deallocateVectorData();
         d_r->freeVectorComponents();
         d_r.setNull();
     }
@@ -88,6 +88,35 @@ KrylovLinearSolverPoissonSolverInterface::setPoissonSpecifications(const Poisson
     return;
 } // setPoissonSpecifications
 
+bool
+KrylovLinearSolverPoissonSolverInterface::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    KrylovLinearSolver* p_this = dynamic_cast<KrylovLinearSolver*>(this);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(p_this);
+#endif
+    // The operator state (e.g., the ghost cell fill pattern) depends on whether
+    // the coefficients are constant, but not on their values.
+    const bool reinit_required =
+        !p_this->getIsInitialized() || d_poisson_spec.dIsConstant() != poisson_spec.dIsConstant();
+    PoissonSolver::setPoissonSpecifications(poisson_spec);
+    Pointer<LaplaceOperator> p_operator = p_this->getOperator();
+    if (p_operator) p_operator->setPoissonSpecifications(d_poisson_spec);
+    Pointer<PoissonSolver> p_preconditioner = p_this->getPreconditioner();
+    if (p_preconditioner)
+    {
+        if (reinit_required)
+        {
+            p_preconditioner->setPoissonSpecifications(d_poisson_spec);
+        }
+        else if (!p_preconditioner->updatePoissonSpecifications(d_poisson_spec))
+        {
+            return false;
+        }
+    }
+    return !reinit_required;
+} // updatePoissonSpecifications
+
 void
 KrylovLinearSolverPoissonSolverInterface::setPhysicalBcCoef(RobinBcCoefStrategy<NDIM>* bc_coef)
 {
@@ -81,6 +81,19 @@ PoissonFACPreconditioner::setPoissonSpecifications(const PoissonSpecifications&
     return;
 } // setPoissonSpecifications
 
+bool
+PoissonFACPreconditioner::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    PoissonSolver::setPoissonSpecifications(poisson_spec);
+    Pointer<PoissonFACPreconditionerStrategy> p_fac_strategy = d_fac_strategy;
+    if (!d_is_initialized || !p_fac_strategy)
+    {
+        if (p_fac_strategy) p_fac_strategy->setPoissonSpecifications(d_poisson_spec);
+        return false;
+    }
+    return p_fac_strategy->updatePoissonSpecifications(d_poisson_spec);
+} // updatePoissonSpecifications
+
 void
 PoissonFACPreconditioner::setPhysicalBcCoef(RobinBcCoefStrategy<NDIM>* bc_coef)
 {
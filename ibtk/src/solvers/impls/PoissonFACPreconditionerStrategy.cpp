@@ -222,6 +222,13 @@ PoissonFACPreconditionerStrategy::setPoissonSpecifications(const PoissonSpecific
     return;
 } // setPoissonSpecifications
 
+bool
+PoissonFACPreconditionerStrategy::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    setPoissonSpecifications(poisson_spec);
+    return false;
+} // updatePoissonSpecifications
+
 void
 PoissonFACPreconditionerStrategy::setPhysicalBcCoef(RobinBcCoefStrategy<NDIM>* const bc_coef)
 {
@@ -73,6 +73,13 @@ PoissonSolver::setPoissonSpecifications(const PoissonSpecifications& poisson_spe
     return;
 } // setPoissonSpecifications
 
+bool
+PoissonSolver::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    setPoissonSpecifications(poisson_spec);
+    return false;
+} // updatePoissonSpecifications
+
 void
 PoissonSolver::setPhysicalBcCoef(RobinBcCoefStrategy<NDIM>* const bc_coef)
 {
@@ -858,19 +858,27 @@ SCPoissonHypreLevelSolver::copyToHypre(HYPRE_SStructVector vector,
                                        const SideData<NDIM, double>& src_data,
                                        const Box<NDIM>& box)
 {
-    const bool copy_data = src_data.getGhostBox() != box;
-    SideData<NDIM, double>* hypre_data =
-        copy_data ? new SideData<NDIM, double>(box, 1, 0) : const_cast<SideData<NDIM, double>*>(&src_data);
-    if (copy_data) hypre_data->copyOnBox(src_data, box);
+    // Values are read directly from the (possibly ghosted) patch data arrays;
+    // hypre uses the data box to compute the strides into those arrays.
+    const Box<NDIM>& data_box = src_data.getGhostBox();
     for (int var = 0; var < NVARS; ++var)
     {
         const unsigned int axis = var;
         Index<NDIM> lower = box.lower();
         lower(axis) -= 1;
         Index<NDIM> upper = box.upper();
-        HYPRE_SStructVectorSetBoxValues(vector, PART, lower, upper, var, hypre_data->getPointer(axis));
+        Index<NDIM> data_lower = data_box.lower();
+        data_lower(axis) -= 1;
+        Index<NDIM> data_upper = data_box.upper();
+        HYPRE_SStructVectorSetBoxValues2(vector,
+                                         PART,
+                                         lower,
+                                         upper,
+                                         var,
+                                         data_lower,
+                                         data_upper,
+                                         const_cast<double*>(src_data.getPointer(axis)));
     }
-    if (hypre_data != &src_data) delete hypre_data;
     return;
 } // copyToHypre
 
@@ -879,21 +887,19 @@ SCPoissonHypreLevelSolver::copyFromHypre(SideData<NDIM, double>& dst_data,
                                          HYPRE_SStructVector vector,
                                          const Box<NDIM>& box)
 {
-    const bool copy_data = dst_data.getGhostBox() != box;
-    SideData<NDIM, double>* hypre_data = copy_data ? new SideData<NDIM, double>(box, 1, 0) : &dst_data;
+    const Box<NDIM>& data_box = dst_data.getGhostBox();
     for (int var = 0; var < NVARS; ++var)
     {
         const unsigned int axis = var;
         Index<NDIM> lower = box.lower();
         lower(axis) -= 1;
         Index<NDIM> upper = box.upper();
-        HYPRE_SStructVectorGetBoxValues(vector, PART, lower, upper, var, hypre_data->getPointer(axis));
+        Index<NDIM> data_lower = data_box.lower();
+        data_lower(axis) -= 1;
+        Index<NDIM> data_upper = data_box.upper();
+        HYPRE_SStructVectorGetBoxValues2(
+            vector, PART, lower, upper, var, data_lower, data_upper, dst_data.getPointer(axis));
     }
-    if (copy_data)
-    {
-        dst_data.copyOnBox(*hypre_data, box);
-    }
-    if (hypre_data != &dst_data) delete hypre_data;
     return;
 } // copyFromHypre
 
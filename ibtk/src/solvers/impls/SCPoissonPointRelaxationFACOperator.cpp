@@ -383,6 +383,17 @@ SCPoissonPointRelaxationFACOperator::setCoarseSolverType(const std::string& coar
     return;
 } // setCoarseSolverType
 
+bool
+SCPoissonPointRelaxationFACOperator::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    setPoissonSpecifications(poisson_spec);
+    const bool constant_coefficients =
+        (d_poisson_spec.cIsZero() || d_poisson_spec.cIsConstant()) && d_poisson_spec.dIsConstant();
+    if (!d_is_initialized || !constant_coefficients) return false;
+    if (d_coarse_solver) return d_coarse_solver->updatePoissonSpecifications(d_poisson_spec);
+    return true;
+} // updatePoissonSpecifications
+
 void
 SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>& error,
                                                  const SAMRAIVectorReal<NDIM, double>& residual,
@@ -228,6 +228,9 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         }
     }
 
+    int silo_number_procs_per_file = 1;
+    if (main_db->keyExists("silo_number_procs_per_file"))
+        silo_number_procs_per_file = main_db->getInteger("silo_number_procs_per_file");
     for (unsigned int i = 0; i < d_viz_writers.size(); i++)
     {
         if (d_viz_writers[i] == "VisIt")
@@ -242,6 +245,7 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         if (d_viz_writers[i] == "Silo")
         {
             d_silo_data_writer = new LSiloDataWriter("LSiloDataWriter", d_viz_dump_dirname);
+            d_silo_data_writer->setNumberOfProcessesPerFile(silo_number_procs_per_file);
         }
 
         if (d_viz_writers[i] == "ExodusII")
@@ -261,6 +265,7 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
                                       << "In the future, it will be necessary to include \"Silo\" in the list of data "
                                          "writer in order to output Silo data.\n");
         d_silo_data_writer = new LSiloDataWriter("LSiloDataWriter", d_viz_dump_dirname);
+        d_silo_data_writer->setNumberOfProcessesPerFile(silo_number_procs_per_file);
     }
 
     // Configure restart options.
@@ -148,6 +148,7 @@ HierarchyIntegrator::HierarchyIntegrator(const std::string& object_name,
     d_enable_logging = false;
     d_bdry_extrap_type = "LINEAR";
     d_manage_hier_math_ops = true;
+    d_hier_math_ops_num_threads = 1;
     d_tag_buffer.resizeArray(1);
     d_tag_buffer[0] = 0;
 
@@ -1534,7 +1535,12 @@ HierarchyIntegrator::buildHierarchyMathOps(Pointer<PatchHierarchy<NDIM> > hierar
     {
         if (!d_hier_math_ops)
         {
-            d_hier_math_ops = new HierarchyMathOps(d_object_name + "::HierarchyMathOps", hierarchy);
+            d_hier_math_ops = new HierarchyMathOps(d_object_name + "::HierarchyMathOps",
+                                                   hierarchy,
+                                                   -1,
+                                                   -1,
+                                                   "CONSERVATIVE_COARSEN",
+                                                   d_hier_math_ops_num_threads);
         }
         d_manage_hier_math_ops = true;
     }
@@ -1588,6 +1594,29 @@ HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("enable_logging")) d_enable_logging = db->getBool("enable_logging");
     if (db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = db->getString("bdry_extrap_type");
     if (db->keyExists("tag_buffer")) d_tag_buffer = db->getIntegerArray("tag_buffer");
+    if (db->keyExists("hier_math_ops_num_threads"))
+    {
+        int num_threads = db->getInteger("hier_math_ops_num_threads");
+        if (num_threads < 1)
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  hier_math_ops_num_threads must be positive."
+                                     << std::endl);
+        }
+#if !defined(_OPENMP)
+        if (num_threads > 1)
+        {
+            TBOX_WARNING(d_object_name << "::getFromInput():\n"
+                                       << "  hier_math_ops_num_threads = "
+                                       << num_threads
+                                       << " was specified, but IBAMR was not configured with --enable-openmp.\n"
+                                       << "  HierarchyMathOps operations will be performed using a single thread."
+                                       << std::endl);
+            num_threads = 1;
+        }
+#endif
+        d_hier_math_ops_num_threads = num_threads;
+    }
     return;
 } // getFromInput
 
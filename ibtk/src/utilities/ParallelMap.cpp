@@ -32,12 +32,14 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <map>
 #include <ostream>
 #include <utility>
 #include <vector>
 
 #include "IntVector.h"
+#include "mpi.h"
 #include "ibtk/FixedSizedStream.h"
 #include "ibtk/ParallelMap.h"
 #include "ibtk/Streamable.h"
@@ -105,51 +107,77 @@ ParallelMap::communicateData()
 {
     const int size = SAMRAI_MPI::getNodes();
     const int rank = SAMRAI_MPI::getRank();
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    StreamableManager* streamable_manager = StreamableManager::getManager();
+
+    // Get the local values to send.
+    std::vector<int> keys_to_send;
+    std::vector<tbox::Pointer<Streamable> > data_items_to_send;
+    for (std::map<int, tbox::Pointer<Streamable> >::const_iterator cit = d_pending_additions.begin();
+         cit != d_pending_additions.end();
+         ++cit)
+    {
+        keys_to_send.push_back(cit->first);
+        data_items_to_send.push_back(cit->second);
+    }
+
+    // Determine how many keys have been registered for addition and removal on
+    // each process, along with the amount of data to be sent by each process.
+    // This requires only a single collective operation, regardless of the
+    // number of processes.
+    static const int NUM_COUNTS = 3;
+    int local_counts[NUM_COUNTS];
+    local_counts[0] = static_cast<int>(keys_to_send.size());
+    local_counts[1] = static_cast<int>(tbox::AbstractStream::sizeofInt() * keys_to_send.size() +
+                                       streamable_manager->getDataStreamSize(data_items_to_send));
+    local_counts[2] = static_cast<int>(d_pending_removals.size());
+    std::vector<int> counts(NUM_COUNTS * size, 0);
+    MPI_Allgather(local_counts, NUM_COUNTS, MPI_INT, &counts[0], NUM_COUNTS, MPI_INT, communicator);
+    std::vector<int> num_additions(size), data_sz(size), num_removals(size);
+    int total_num_additions = 0, total_data_sz = 0, total_num_removals = 0;
+    for (int proc = 0; proc < size; ++proc)
+    {
+        num_additions[proc] = counts[NUM_COUNTS * proc];
+        data_sz[proc] = counts[NUM_COUNTS * proc + 1];
+        num_removals[proc] = counts[NUM_COUNTS * proc + 2];
+        total_num_additions += num_additions[proc];
+        total_data_sz += data_sz[proc];
+        total_num_removals += num_removals[proc];
+    }
 
     // Add items to the map.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_additions.size())) > 0)
+    if (total_num_additions > 0)
     {
-        StreamableManager* streamable_manager = StreamableManager::getManager();
-
-        // Determine how many keys have been registered for addition on each
-        // process.
-        std::vector<int> num_additions(size, 0);
-        num_additions[rank] = static_cast<int>(d_pending_additions.size());
-        SAMRAI_MPI::sumReduction(&num_additions[0], size);
-
-        // Get the local values to send and determine the amount of data to be
-        // broadcast by each process.
-        std::vector<int> keys_to_send;
-        std::vector<tbox::Pointer<Streamable> > data_items_to_send;
-        for (std::map<int, tbox::Pointer<Streamable> >::const_iterator cit = d_pending_additions.begin();
-             cit != d_pending_additions.end();
-             ++cit)
+        // Pack the local data into a single buffer and gather the packed data
+        // from all processes.
+        FixedSizedStream stream(data_sz[rank]);
+        if (!keys_to_send.empty())
         {
-            keys_to_send.push_back(cit->first);
-            data_items_to_send.push_back(cit->second);
+            stream.pack(&keys_to_send[0], static_cast<int>(keys_to_send.size()));
+            streamable_manager->packStream(stream, data_items_to_send);
         }
-        std::vector<int> data_sz(size, 0);
-        data_sz[rank] = static_cast<int>(tbox::AbstractStream::sizeofInt() * keys_to_send.size() +
-                                         streamable_manager->getDataStreamSize(data_items_to_send));
-        SAMRAI_MPI::sumReduction(&data_sz[0], size);
-
-        // Broadcast data from each process.
+#if !defined(NDEBUG)
+        TBOX_ASSERT(stream.getCurrentSize() == data_sz[rank]);
+#endif
+        std::vector<int> data_offset(size, 0);
+        for (int proc = 1; proc < size; ++proc) data_offset[proc] = data_offset[proc - 1] + data_sz[proc - 1];
+        std::vector<char> buffer(std::max(total_data_sz, 1));
+        MPI_Allgatherv(stream.getBufferStart(),
+                       data_sz[rank],
+                       MPI_CHAR,
+                       &buffer[0],
+                       &data_sz[0],
+                       &data_offset[0],
+                       MPI_CHAR,
+                       communicator);
+
+        // Unpack the data in order of increasing process rank.
         for (int sending_proc = 0; sending_proc < size; ++sending_proc)
         {
-            int num_keys = num_additions[sending_proc];
+            const int num_keys = num_additions[sending_proc];
             if (num_keys == 0) continue;
             if (sending_proc == rank)
             {
-                // Pack and broadcast data on process sending_proc.
-                FixedSizedStream stream(data_sz[sending_proc]);
-                stream.pack(&keys_to_send[0], static_cast<int>(keys_to_send.size()));
-                streamable_manager->packStream(stream, data_items_to_send);
-                int data_size = stream.getCurrentSize();
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_additions.size()) == num_keys);
-                TBOX_ASSERT(data_size == data_sz[sending_proc]);
-#endif
-                SAMRAI_MPI::bcast(static_cast<char*>(stream.getBufferStart()), data_size, sending_proc);
                 for (int k = 0; k < num_keys; ++k)
                 {
                     d_map[keys_to_send[k]] = data_items_to_send[k];
@@ -157,19 +185,12 @@ ParallelMap::communicateData()
             }
             else
             {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<char> buffer(data_sz[sending_proc]);
-                int data_size = data_sz[sending_proc];
-                SAMRAI_MPI::bcast(&buffer[0], data_size, sending_proc);
-#if !defined(NDEBUG)
-                TBOX_ASSERT(data_size == data_sz[sending_proc]);
-#endif
-                FixedSizedStream stream(&buffer[0], data_size);
+                FixedSizedStream recv_stream(&buffer[data_offset[sending_proc]], data_sz[sending_proc]);
                 std::vector<int> keys_received(num_keys);
-                stream.unpack(&keys_received[0], num_keys);
+                recv_stream.unpack(&keys_received[0], num_keys);
                 std::vector<tbox::Pointer<Streamable> > data_items_received;
                 hier::IntVector<NDIM> offset = 0;
-                streamable_manager->unpackStream(stream, offset, data_items_received);
+                streamable_manager->unpackStream(recv_stream, offset, data_items_received);
 #if !defined(NDEBUG)
                 TBOX_ASSERT(keys_received.size() == data_items_received.size());
 #endif
@@ -179,52 +200,37 @@ ParallelMap::communicateData()
                 }
             }
         }
-
-        // Clear the set of pending additions.
-        d_pending_additions.clear();
     }
 
+    // Clear the set of pending additions.
+    d_pending_additions.clear();
+
     // Remove items from the map.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_removals.size())) > 0)
+    if (total_num_removals > 0)
     {
-        // Determine how many keys have been registered for removal on each
-        // process.
-        std::vector<int> num_removals(size, 0);
-        num_removals[rank] = static_cast<int>(d_pending_removals.size());
-        SAMRAI_MPI::sumReduction(&num_removals[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        // Gather the keys registered for removal on all processes.
+        std::vector<int> removal_offset(size, 0);
+        for (int proc = 1; proc < size; ++proc)
         {
-            int num_keys = num_removals[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_removals.size()) == num_keys);
-#endif
-                SAMRAI_MPI::bcast(&d_pending_removals[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_map.erase(d_pending_removals[k]);
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_removals[sending_proc]);
-                SAMRAI_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_map.erase(keys_received[k]);
-                }
-            }
+            removal_offset[proc] = removal_offset[proc - 1] + num_removals[proc - 1];
+        }
+        std::vector<int> keys_received(total_num_removals);
+        MPI_Allgatherv(d_pending_removals.empty() ? NULL : &d_pending_removals[0],
+                       num_removals[rank],
+                       MPI_INT,
+                       &keys_received[0],
+                       &num_removals[0],
+                       &removal_offset[0],
+                       MPI_INT,
+                       communicator);
+        for (int k = 0; k < total_num_removals; ++k)
+        {
+            d_map.erase(keys_received[k]);
         }
-
-        // Clear the set of pending removals.
-        d_pending_removals.clear();
     }
+
+    // Clear the set of pending removals.
+    d_pending_removals.clear();
     return;
 } // communicateData
 
@@ -38,6 +38,7 @@
 
 #include "ibtk/ParallelSet.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
@@ -98,90 +99,70 @@ ParallelSet::communicateData()
 {
     const int size = SAMRAI_MPI::getNodes();
     const int rank = SAMRAI_MPI::getRank();
-
-    // Add items from the set.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_additions.size())) > 0)
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+
+    // Determine how many keys have been registered for addition and removal on
+    // each process.  This requires only a single collective operation,
+    // regardless of the number of processes.
+    static const int NUM_COUNTS = 2;
+    int local_counts[NUM_COUNTS];
+    local_counts[0] = static_cast<int>(d_pending_additions.size());
+    local_counts[1] = static_cast<int>(d_pending_removals.size());
+    std::vector<int> counts(NUM_COUNTS * size, 0);
+    MPI_Allgather(local_counts, NUM_COUNTS, MPI_INT, &counts[0], NUM_COUNTS, MPI_INT, communicator);
+    std::vector<int> num_additions(size), num_removals(size);
+    std::vector<int> addition_offset(size, 0), removal_offset(size, 0);
+    for (int proc = 0; proc < size; ++proc)
     {
-        // Determine how many keys have been registered for addition on each
-        // process.
-        std::vector<int> num_additions(size, 0);
-        num_additions[rank] = static_cast<int>(d_pending_additions.size());
-        SAMRAI_MPI::sumReduction(&num_additions[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        num_additions[proc] = counts[NUM_COUNTS * proc];
+        num_removals[proc] = counts[NUM_COUNTS * proc + 1];
+        if (proc > 0)
         {
-            int num_keys = num_additions[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_additions.size()) == num_keys);
-#endif
-                SAMRAI_MPI::bcast(&d_pending_additions[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.insert(d_pending_additions[k]);
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_additions[sending_proc]);
-                SAMRAI_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.insert(keys_received[k]);
-                }
-            }
+            addition_offset[proc] = addition_offset[proc - 1] + num_additions[proc - 1];
+            removal_offset[proc] = removal_offset[proc - 1] + num_removals[proc - 1];
         }
+    }
+    const int total_num_additions = addition_offset[size - 1] + num_additions[size - 1];
+    const int total_num_removals = removal_offset[size - 1] + num_removals[size - 1];
 
-        // Clear the set of pending additions.
-        d_pending_additions.clear();
+    // Add items to the set.
+    if (total_num_additions > 0)
+    {
+        std::vector<int> keys_received(total_num_additions);
+        MPI_Allgatherv(d_pending_additions.empty() ? NULL : &d_pending_additions[0],
+                       num_additions[rank],
+                       MPI_INT,
+                       &keys_received[0],
+                       &num_additions[0],
+                       &addition_offset[0],
+                       MPI_INT,
+                       communicator);
+        d_set.insert(keys_received.begin(), keys_received.end());
     }
 
+    // Clear the set of pending additions.
+    d_pending_additions.clear();
+
     // Remove items from the set.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_removals.size())) > 0)
+    if (total_num_removals > 0)
     {
-        // Determine how many keys have been registered for removal on each
-        // process.
-        std::vector<int> num_removals(size, 0);
-        num_removals[rank] = static_cast<int>(d_pending_removals.size());
-        SAMRAI_MPI::sumReduction(&num_removals[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        std::vector<int> keys_received(total_num_removals);
+        MPI_Allgatherv(d_pending_removals.empty() ? NULL : &d_pending_removals[0],
+                       num_removals[rank],
+                       MPI_INT,
+                       &keys_received[0],
+                       &num_removals[0],
+                       &removal_offset[0],
+                       MPI_INT,
+                       communicator);
+        for (int k = 0; k < total_num_removals; ++k)
         {
-            int num_keys = num_removals[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_removals.size()) == num_keys);
-#endif
-                SAMRAI_MPI::bcast(&d_pending_removals[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.erase(d_pending_removals[k]);
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_removals[sending_proc]);
-                SAMRAI_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.erase(keys_received[k]);
-                }
-            }
+            d_set.erase(keys_received[k]);
         }
-
-        // Clear the set of pending removals.
-        d_pending_removals.clear();
     }
+
+    // Clear the set of pending removals.
+    d_pending_removals.clear();
     return;
 } // communicateData
 
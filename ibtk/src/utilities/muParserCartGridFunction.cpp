@@ -32,31 +32,28 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <map>
 #include <ostream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
-#include "CellIndex.h"
-#include "CellIterator.h"
 #include "FaceData.h"
 #include "FaceIndex.h"
-#include "FaceIterator.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "NodeData.h"
-#include "NodeIndex.h"
-#include "NodeIterator.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SideData.h"
-#include "SideIndex.h"
-#include "SideIterator.h"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/muParserCartGridFunction.h"
@@ -92,6 +89,15 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Identifiers for the data centerings, used to index cached function values.
+static const int CELL_CENTERING = 0;
+static const int NODE_CENTERING = 1;
+static const int SIDE_CENTERING = 2;
+static const int FACE_CENTERING = 2 + NDIM;
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 muParserCartGridFunction::muParserCartGridFunction(const std::string& object_name,
@@ -103,7 +109,11 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
       d_function_strings(),
       d_parsers(),
       d_parser_time(),
-      d_parser_posn()
+      d_parser_posn(),
+      d_parser_is_time_dependent(),
+      d_cached_values(),
+      d_cached_levels(),
+      d_values()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -275,19 +285,35 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
         {
             it->DefineConst(map_cit->first, map_cit->second);
         }
+    }
 
-        // Variables.
-        it->DefineVar("T", &d_parser_time);
-        it->DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Variables.
+    resizeParserVariables(1);
+
+    // Determine which functions depend on time.  The values of the other
+    // functions are cached and reused until the patch configuration changes.
+    d_parser_is_time_dependent.resize(d_parsers.size());
+    for (unsigned int k = 0; k < d_parsers.size(); ++k)
+    {
+        try
         {
-            std::ostringstream stream;
-            stream << d;
-            const std::string postfix = stream.str();
-            it->DefineVar("X" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("X_" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x_" + postfix, &(d_parser_posn[d]));
+            const mu::varmap_type& used_vars = d_parsers[k].GetUsedVar();
+            d_parser_is_time_dependent[k] = used_vars.count("T") || used_vars.count("t");
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  error: "
+                       << e.GetMsg()
+                       << "\n"
+                       << "  in:    "
+                       << e.GetExpr()
+                       << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
         }
     }
     return;
@@ -305,22 +331,34 @@ muParserCartGridFunction::isTimeDependent() const
     return true;
 } // isTimeDependent
 
+void
+muParserCartGridFunction::setDataOnPatchHierarchy(const int data_idx,
+                                                  Pointer<Variable<NDIM> > var,
+                                                  Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                  const double data_time,
+                                                  const bool initial_time,
+                                                  const int coarsest_ln,
+                                                  const int finest_ln)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+#endif
+    pruneCachedValues(hierarchy->getFinestLevelNumber());
+    CartGridFunction::setDataOnPatchHierarchy(
+        data_idx, var, hierarchy, data_time, initial_time, coarsest_ln, finest_ln);
+    return;
+} // setDataOnPatchHierarchy
+
 void
 muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          Pointer<Variable<NDIM> > /*var*/,
                                          Pointer<Patch<NDIM> > patch,
                                          const double data_time,
                                          const bool /*initial_time*/,
-                                         Pointer<PatchLevel<NDIM> > /*level*/)
+                                         Pointer<PatchLevel<NDIM> > level)
 {
-    d_parser_time = data_time;
-
+    if (level) resetCachedValues(level);
     const Box<NDIM>& patch_box = patch->getBox();
-    const Index<NDIM>& patch_lower = patch_box.lower();
-    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-
-    const double* const XLower = pgeom->getXLower();
-    const double* const dx = pgeom->getDx();
 
     // Set the data in the patch.
     Pointer<PatchData<NDIM> > data = patch->getPatchData(data_idx);
@@ -336,35 +374,16 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(cc_data->getDepth()));
 #endif
+        ArrayData<NDIM, double>& cc_array_data = cc_data->getArrayData();
         for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            const std::vector<double>& values =
+                getFunctionValues(function_depth, CELL_CENTERING, patch_box, IntVector<NDIM>(1), patch, data_time);
+            int k = 0;
+            for (Box<NDIM>::Iterator b(patch_box); b; b++, ++k)
             {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
-                {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
+                cc_array_data(b(), data_depth) = values[k];
             }
         }
     }
@@ -399,41 +418,17 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     function_depth = NDIM * data_depth + axis;
                 }
 
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                // Faces are indexed by the cells on their upper sides.
+                Box<NDIM> face_box = patch_box;
+                face_box.upper(axis) += 1;
+                IntVector<NDIM> cell_centered_axes(1);
+                cell_centered_axes(axis) = 0;
+                const std::vector<double>& values = getFunctionValues(
+                    function_depth, FACE_CENTERING + axis, face_box, cell_centered_axes, patch, data_time);
+                int k = 0;
+                for (Box<NDIM>::Iterator b(face_box); b; b++, ++k)
                 {
-                    const FaceIndex<NDIM>& i = ic();
-                    const Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                    (*fc_data)(FaceIndex<NDIM>(b(), axis, FaceIndex<NDIM>::Lower), data_depth) = values[k];
                 }
             }
         }
@@ -443,35 +438,18 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(nc_data->getDepth()));
 #endif
+        Box<NDIM> node_box = patch_box;
+        node_box.growUpper(IntVector<NDIM>(1));
+        ArrayData<NDIM, double>& nc_array_data = nc_data->getArrayData();
         for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
+            const std::vector<double>& values =
+                getFunctionValues(function_depth, NODE_CENTERING, node_box, IntVector<NDIM>(0), patch, data_time);
+            int k = 0;
+            for (Box<NDIM>::Iterator b(node_box); b; b++, ++k)
             {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
+                nc_array_data(b(), data_depth) = values[k];
             }
         }
     }
@@ -506,39 +484,17 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     function_depth = NDIM * data_depth + axis;
                 }
 
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                Box<NDIM> side_box = patch_box;
+                side_box.upper(axis) += 1;
+                IntVector<NDIM> cell_centered_axes(1);
+                cell_centered_axes(axis) = 0;
+                const std::vector<double>& values = getFunctionValues(
+                    function_depth, SIDE_CENTERING + axis, side_box, cell_centered_axes, patch, data_time);
+                ArrayData<NDIM, double>& sc_array_data = sc_data->getArrayData(axis);
+                int k = 0;
+                for (Box<NDIM>::Iterator b(side_box); b; b++, ++k)
                 {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                    sc_array_data(b(), data_depth) = values[k];
                 }
             }
         }
@@ -552,6 +508,168 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     return;
 } // setDataOnPatch
 
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+muParserCartGridFunction::resizeParserVariables(const int size)
+{
+    if (static_cast<int>(d_parser_time.size()) >= size && !d_parser_time.empty()) return;
+
+    // The parsers read variable values through pointers, so the variables must
+    // be redefined whenever the arrays are reallocated.
+    d_parser_time.resize(std::max(size, 1));
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        d_parser_posn[d].resize(d_parser_time.size());
+    }
+    for (std::vector<mu::Parser>::iterator it = d_parsers.begin(); it != d_parsers.end(); ++it)
+    {
+        it->DefineVar("T", &d_parser_time[0]);
+        it->DefineVar("t", &d_parser_time[0]);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            std::ostringstream stream;
+            stream << d;
+            const std::string postfix = stream.str();
+            it->DefineVar("X" + postfix, &d_parser_posn[d][0]);
+            it->DefineVar("x" + postfix, &d_parser_posn[d][0]);
+            it->DefineVar("X_" + postfix, &d_parser_posn[d][0]);
+            it->DefineVar("x_" + postfix, &d_parser_posn[d][0]);
+        }
+    }
+    return;
+} // resizeParserVariables
+
+void
+muParserCartGridFunction::resetCachedValues(Pointer<PatchLevel<NDIM> > level)
+{
+    const int ln = level->getLevelNumber();
+    if (ln < 0) return;
+    if (ln >= static_cast<int>(d_cached_levels.size())) d_cached_levels.resize(ln + 1, NULL);
+    if (d_cached_levels[ln] == level.getPointer()) return;
+
+    // The level has been regridded or replaced, so the cached values of the
+    // old level are discarded rather than left to accumulate.
+    d_cached_levels[ln] = level.getPointer();
+    for (std::map<boost::array<int, 4>, CachedValues>::iterator it = d_cached_values.begin();
+         it != d_cached_values.end();)
+    {
+        if (it->first[0] == ln)
+        {
+            d_cached_values.erase(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return;
+} // resetCachedValues
+
+void
+muParserCartGridFunction::pruneCachedValues(const int finest_ln)
+{
+    if (finest_ln + 1 < static_cast<int>(d_cached_levels.size())) d_cached_levels.resize(finest_ln + 1);
+    for (std::map<boost::array<int, 4>, CachedValues>::iterator it = d_cached_values.begin();
+         it != d_cached_values.end();)
+    {
+        if (it->first[0] > finest_ln)
+        {
+            d_cached_values.erase(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return;
+} // pruneCachedValues
+
+const std::vector<double>&
+muParserCartGridFunction::getFunctionValues(const int function_depth,
+                                            const int centering,
+                                            const Box<NDIM>& box,
+                                            const IntVector<NDIM>& cell_centered_axes,
+                                            Pointer<Patch<NDIM> > patch,
+                                            const double data_time)
+{
+    const Index<NDIM>& patch_lower = patch->getBox().lower();
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const XLower = pgeom->getXLower();
+    const double* const XUpper = pgeom->getXUpper();
+    const double* const dx = pgeom->getDx();
+
+    // Look up previously computed values of time-independent functions.  The
+    // values are reused only if neither the patch box nor the patch extents
+    // have changed since they were computed.
+    const bool use_cache = !d_parser_is_time_dependent[function_depth];
+    boost::array<double, 2 * NDIM> patch_extents;
+    std::copy(XLower, XLower + NDIM, patch_extents.begin());
+    std::copy(XUpper, XUpper + NDIM, patch_extents.begin() + NDIM);
+    boost::array<int, 4> cache_key;
+    cache_key[0] = patch->getPatchLevelNumber();
+    cache_key[1] = patch->getPatchNumber();
+    cache_key[2] = function_depth;
+    cache_key[3] = centering;
+    if (use_cache)
+    {
+        std::map<boost::array<int, 4>, CachedValues>::const_iterator cit = d_cached_values.find(cache_key);
+        if (cit != d_cached_values.end() && cit->second.box == box && cit->second.patch_extents == patch_extents)
+        {
+            return cit->second.values;
+        }
+    }
+
+    // Set the positions of all of the points in the box, and evaluate the
+    // function at all of the points with a single call to the parser.
+    const int num_points = box.size();
+    resizeParserVariables(num_points);
+    std::fill(d_parser_time.begin(), d_parser_time.begin() + num_points, data_time);
+    int k = 0;
+    for (Box<NDIM>::Iterator b(box); b; b++, ++k)
+    {
+        const Index<NDIM>& i = b();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) +
+                                                       (cell_centered_axes(d) ? 0.5 : 0.0));
+        }
+    }
+    std::vector<double>& values = use_cache ? d_cached_values[cache_key].values : d_values;
+    values.resize(num_points);
+    if (num_points > 0)
+    {
+        try
+        {
+            d_parsers[function_depth].Eval(&values[0], num_points);
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                       << "  error: "
+                       << e.GetMsg()
+                       << "\n"
+                       << "  in:    "
+                       << e.GetExpr()
+                       << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
+        }
+    }
+    if (use_cache)
+    {
+        CachedValues& cached_values = d_cached_values[cache_key];
+        cached_values.box = box;
+        cached_values.patch_extents = patch_extents;
+    }
+    return values;
+} // getFunctionValues
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -228,10 +228,11 @@ private:
     void calculateKinematicsVelocity();
 
     /*!
-     * \brief Calculate momentum of kinematics velocity. This is extraneous momentum
-     * that needs to be subtracted from the kinematics velocity.
+     * \brief Calculate momentum of kinematics velocity of all self-translating
+     * structures. This is extraneous momentum that needs to be subtracted from
+     * the kinematics velocity.
      */
-    void calculateMomentumOfKinematicsVelocity(const int position_handle);
+    void calculateMomentumOfKinematicsVelocity();
 
     /*!
      * \brief Calculate volume element associated with material points.
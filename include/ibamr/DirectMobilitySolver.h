@@ -231,17 +231,23 @@ private:
     /*!
      * \brief Factorize mobility matrix using direct solvers.
      */
-    void factorizeMobilityMatrix();
+    void factorizeMobilityMatrix(const std::string& mat_name);
 
     /*!
      * \brief Construct body mobility matrix as N = K^T inv(M) K.
      */
-    void constructBodyMobilityMatrix();
+    void constructBodyMobilityMatrix(const std::string& mat_name);
 
     /*!
      * \brief Factorize body mobility matrix using direct solvers.
      */
-    void factorizeBodyMobilityMatrix();
+    void factorizeBodyMobilityMatrix(const std::string& mat_name);
+
+    /*!
+     * \brief Report the memory used by the dense matrices and their
+     * factorizations.
+     */
+    void reportMemoryUsage() const;
 
     /*!
      * \brief Factorize dense matrix.
@@ -278,6 +284,9 @@ private:
     std::map<std::string, std::pair<double, double> > d_mat_scale_map;
     std::map<std::string, std::string> d_mat_filename_map;
     std::map<std::string, std::pair<int*, int*> > d_ipiv_map; // permutation matrices for LU
+    std::map<std::string, bool> d_mat_recompute_map;          // recompute in current configuration
+    std::map<std::string, bool> d_mat_factorized_map;         // factorization is available
+    std::map<std::string, double> d_mat_dt_map;               // time step size used in factorization
 
     // PETSc representation of matrices.
     std::map<std::string, std::pair<Mat, Mat> > d_petsc_mat_map;
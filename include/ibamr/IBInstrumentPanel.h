@@ -35,9 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
-#include <functional>
 #include <iosfwd>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -242,42 +240,28 @@ private:
      * \brief Data structures employed to manage mappings between cell indices
      * and web patch data (i.e., patch centroids and area-weighted normals) and
      * meter centroid data.
+     *
+     * Web patches and web centroids are stored only for local patches, and are
+     * indexed by level number and patch number.
      */
-    struct IndexFortranOrder : public std::binary_function<SAMRAI::hier::Index<NDIM>, SAMRAI::hier::Index<NDIM>, bool>
-    {
-        inline bool operator()(const SAMRAI::hier::Index<NDIM>& lhs, const SAMRAI::hier::Index<NDIM>& rhs) const
-        {
-            return (lhs(0) < rhs(0)
-#if (NDIM > 1)
-                    ||
-                    (lhs(0) == rhs(0) && lhs(1) < rhs(1))
-#if (NDIM > 2)
-                    ||
-                    (lhs(0) == rhs(0) && lhs(1) == rhs(1) && lhs(2) < rhs(2))
-#endif
-#endif
-                        );
-        } // operator()
-    };
-
     struct WebPatch
     {
+        SAMRAI::hier::Index<NDIM> cell_idx;
         int meter_num;
         const IBTK::Vector* X;
         const IBTK::Vector* dA;
     };
 
-    typedef std::multimap<SAMRAI::hier::Index<NDIM>, WebPatch, IndexFortranOrder> WebPatchMap;
-    std::vector<WebPatchMap> d_web_patch_map;
+    std::vector<std::vector<std::vector<WebPatch> > > d_web_patches;
 
     struct WebCentroid
     {
+        SAMRAI::hier::Index<NDIM> cell_idx;
         int meter_num;
         const IBTK::Vector* X;
     };
 
-    typedef std::multimap<SAMRAI::hier::Index<NDIM>, WebCentroid, IndexFortranOrder> WebCentroidMap;
-    std::vector<WebCentroidMap> d_web_centroid_map;
+    std::vector<std::vector<std::vector<WebCentroid> > > d_web_centroids;
 
     /*
      * The directory where data is to be dumped and the most recent timestep
@@ -532,6 +532,12 @@ protected:
      */
     IBTK::LDataManager* d_l_data_manager;
     std::string d_interp_kernel_fcn, d_spread_kernel_fcn;
+    bool d_use_threaded_spreading;
+    bool d_use_cell_sorted_kernels;
+    bool d_use_measured_workload_estimates;
+    std::vector<std::string> d_workload_marker_timer_names, d_workload_force_timer_names,
+        d_workload_eul_timer_names;
+    bool d_use_incremental_data_redistribution;
     bool d_error_if_points_leave_domain;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
 
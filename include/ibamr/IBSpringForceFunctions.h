@@ -65,6 +65,30 @@ typedef double (*SpringForceFcnPtr)(double R, const double* params, int lag_mast
  */
 typedef double (*SpringForceDerivFcnPtr)(double R, const double* params, int lag_mastr_idx, int lag_slave_idx);
 
+/*!
+ * \brief Typedef specifying the batched spring force function API.
+ *
+ * Batched spring force functions compute the tension forces generated by a
+ * group of springs that all use the same force function.  The constitutive
+ * parameters are provided in structure-of-arrays form, i.e., parameter \a j of
+ * spring \a k is params[j*params_stride+k].
+ *
+ * \param T               The (undirected) "tension" forces generated by the springs.
+ * \param R               The distances between the "master" and "slave" nodes associated with the springs.
+ * \param params          Constitutive parameters, in structure-of-arrays form.
+ * \param params_stride   The stride between consecutive parameters in \a params.
+ * \param lag_mastr_idxs  The Lagrangian indices of the "master" nodes associated with the springs.
+ * \param lag_slave_idxs  The Lagrangian indices of the "slave" nodes associated with the springs.
+ * \param num_springs     The number of springs.
+ */
+typedef void (*SpringForceBatchFcnPtr)(double* T,
+                                       const double* R,
+                                       const double* params,
+                                       int params_stride,
+                                       const int* lag_mastr_idxs,
+                                       const int* lag_slave_idxs,
+                                       int num_springs);
+
 /*!
  * \brief Function to compute the (undirected) "tension" force generated by a
  * Hookean spring with either a zero or a non-zero resting length.
@@ -119,6 +143,27 @@ default_spring_force(double R, const double* params, int /*lag_mastr_idx*/, int
     return params[0] * (R - params[1]);
 } // default_spring_force
 
+/*!
+ * \brief Batched version of default_spring_force().
+ */
+inline void
+default_spring_force_batch(double* const T,
+                           const double* const R,
+                           const double* const params,
+                           const int params_stride,
+                           const int* /*lag_mastr_idxs*/,
+                           const int* /*lag_slave_idxs*/,
+                           const int num_springs)
+{
+    const double* const kappa = params;
+    const double* const rst = params + params_stride;
+    for (int k = 0; k < num_springs; ++k)
+    {
+        T[k] = kappa[k] * (R[k] - rst[k]);
+    }
+    return;
+} // default_spring_force_batch
+
 /*!
  * \brief Function to compute the derivative with respect to R of the tension
  * force generated by a Hookean spring with either a zero or a non-zero resting
@@ -79,6 +79,14 @@ namespace IBAMR
  * force function with any function that implements the interface required by
  * registerSpringForceFunction().  Users may also specify additional force
  * functions that may be associated with arbitrary integer indices.
+ *
+ * \note When IBAMR is configured with --enable-openmp, the spring, beam, and
+ * target point forces may be computed using multiple threads on each MPI
+ * process.  The number of threads is set by the optional input key \p
+ * num_threads (default 1); a warning is emitted if num_threads > 1 is
+ * requested when OpenMP is not available.  Spring and beam forces computed by
+ * the different threads are accumulated separately and summed, so results
+ * computed with different numbers of threads may differ by roundoff.
  */
 class IBStandardForceGen : public IBLagrangianForceStrategy
 {
@@ -102,12 +110,22 @@ public:
      * particular spring for the specified displacement, spring constant, rest
      * length, and Lagrangian index.
      *
+     * If a batched version of the force function is provided, it is used to
+     * evaluate the forces for all of the springs associated with \a
+     * force_fcn_index; otherwise, the force function is evaluated separately
+     * for each spring.  \a spring_force_batch_num_params is the number of
+     * constitutive parameters read by the batched function for each spring.
+     * Parameters that are not provided for a particular spring are passed to
+     * the batched function as zero.
+     *
      * \note By default, function default_linear_spring_force() is associated
      * with \a force_fcn_idx 0.
      */
     void registerSpringForceFunction(int force_fcn_index,
                                      const SpringForceFcnPtr spring_force_fcn_ptr,
-                                     const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr = NULL);
+                                     const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr = NULL,
+                                     const SpringForceBatchFcnPtr spring_force_batch_fcn_ptr = NULL,
+                                     int spring_force_batch_num_params = 2);
 
     /*!
      * \brief Setup the data needed to compute the forces on the specified level
@@ -200,14 +218,27 @@ private:
      * \name Data maintained separately for each level of the patch hierarchy.
      */
     //\{
+    struct SpringForceGroup
+    {
+        SpringForceFcnPtr force_fcn;
+        SpringForceBatchFcnPtr force_batch_fcn;
+        int force_batch_num_parameters;
+        int max_num_parameters;
+        std::vector<int> lag_mastr_node_idxs, lag_slave_node_idxs;
+        std::vector<int> petsc_mastr_node_idxs, petsc_slave_node_idxs;
+        std::vector<int> num_parameters;
+        std::vector<const double*> parameters;
+    };
     struct SpringData
     {
         std::vector<int> lag_mastr_node_idxs, lag_slave_node_idxs;
         std::vector<int> petsc_mastr_node_idxs, petsc_slave_node_idxs;
         std::vector<int> petsc_global_mastr_node_idxs, petsc_global_slave_node_idxs;
+        std::vector<int> force_fcn_idxs, num_parameters;
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+        std::vector<SpringForceGroup> force_groups;
     };
     std::vector<SpringData> d_spring_data;
 
@@ -241,6 +272,7 @@ private:
                                    double init_data_time,
                                    bool initial_time,
                                    IBTK::LDataManager* l_data_manager);
+    void initializeSpringForceGroups(int level_number);
     void computeLagrangianSpringForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                       SAMRAI::tbox::Pointer<IBTK::LData> X_data,
                                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
@@ -281,16 +313,35 @@ private:
                                            double data_time,
                                            IBTK::LDataManager* l_data_manager);
 
+    /*!
+     * Routines for accumulating forces computed by multiple threads.
+     *
+     * initializeThreadForceData() returns the number of threads to use and
+     * allocates zero-initialized force arrays for all threads but the first.
+     * accumulateThreadForceData() must be called by all threads in the
+     * parallel region, and adds those arrays to the force array.
+     */
+    int initializeThreadForceData(int num_values);
+    void accumulateThreadForceData(double* F_node, int num_values);
+
     /*!
      * \brief Spring force functions.
      */
     std::map<int, SpringForceFcnPtr> d_spring_force_fcn_map;
     std::map<int, SpringForceDerivFcnPtr> d_spring_force_deriv_fcn_map;
+    std::map<int, SpringForceBatchFcnPtr> d_spring_force_batch_fcn_map;
+    std::map<int, int> d_spring_force_batch_num_params_map;
 
     /*!
      * \brief Logging settings.
      */
     bool d_log_target_point_displacements;
+
+    /*!
+     * \brief Threading settings.
+     */
+    int d_num_threads;
+    std::vector<std::vector<double> > d_F_thread_data;
 };
 } // namespace IBAMR
 
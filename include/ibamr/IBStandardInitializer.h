@@ -421,6 +421,34 @@ namespace IBAMR
  D2_x_2   D2_y_2   D2_z_2  # coordinates of director D2 associated with vertex 2
  ...
  \endverbatim
+ *
+ * <HR>
+ *
+ * <B>Binary vertex and spring file formats</B>
+ *
+ * If the input database entry <TT>use_binary_structure_files</TT> is set to
+ * <TT>TRUE</TT>, vertex and spring data are instead read from binary files with
+ * the extensions <TT>".vertex.bin"</TT> and <TT>".spring.bin"</TT>.  These
+ * files store their contents in native byte order and can be generated from
+ * existing ASCII input files by convertStructureFilesToBinary().  Each file
+ * consists of a header of three integers, starting with a file identifier,
+ * followed by one or more arrays:
+ \verbatim
+ .vertex.bin:  id  NDIM  N        # header
+               x_0 y_0 (z_0) ...  # N*NDIM doubles
+ .spring.bin:  id  M  P           # header; P is the total number of spring parameters
+               i_0 j_0 fcn_idx_0 num_params_0 ...  # 4*M integers
+               kappa_0 length_0 (params_0) ...     # P doubles
+ \endverbatim
+ *
+ * A structure may have no springs, in which case M and P are zero.  The header
+ * counts are checked against the size of the file before the data are read.
+ * The tools convert_structure_files2d and convert_structure_files3d (built by
+ * <TT>make tools</TT>) convert the ASCII files of one or more structures.
+ *
+ * The shift and scale factors are applied to the data read from binary files
+ * in the same manner as to the data read from ASCII files.  All other
+ * structure files are always read in ASCII format.
 */
 class IBStandardInitializer : public IBTK::LInitStrategy
 {
@@ -549,6 +577,19 @@ public:
                                       double error_data_time,
                                       int tag_index);
 
+    /*!
+     * \brief Convert the ASCII vertex and (optional) spring files of a
+     * structure to the binary file formats.
+     *
+     * The files <TT>base_filename.vertex</TT> and <TT>base_filename.spring</TT>
+     * are converted to <TT>base_filename.vertex.bin</TT> and
+     * <TT>base_filename.spring.bin</TT>.
+     *
+     * \note This method is not collective and should be called by only one MPI
+     * process.
+     */
+    static void convertStructureFilesToBinary(const std::string& base_filename);
+
 protected:
 private:
     /*!
@@ -746,6 +787,11 @@ private:
      */
     bool d_use_file_batons;
 
+    /*
+     * Whether to read vertex and spring data from binary input files.
+     */
+    bool d_use_binary_structure_files;
+
     /*
      * The maximum number of levels in the Cartesian grid patch hierarchy and a
      * vector of boolean values indicating whether a particular level has been
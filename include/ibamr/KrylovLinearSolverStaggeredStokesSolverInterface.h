@@ -89,6 +89,14 @@ public:
      */
     void setVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
 
+    /*!
+     * \brief Reset the coefficients for the momentum equation of an
+     * initialized solver without reinitializing its solver state.
+     *
+     * \see StaggeredStokesSolver::updateVelocityPoissonSpecifications()
+     */
+    bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
+
     /*!
      * \brief Set if velocity and pressure have nullspace.
      */
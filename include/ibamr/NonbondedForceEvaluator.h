@@ -35,6 +35,8 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <vector>
+
 #include "tbox/Array.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
@@ -68,7 +70,23 @@ public:
                         std::vector<int> cell_offset,
                         SAMRAI::tbox::Pointer<IBTK::LData> F_data);
 
+    // Implementation of initializeLevelData.  Invalidates any cached Verlet
+    // lists, since the local PETSc indexing of the nodes may have changed.
+    void initializeLevelData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool initial_time,
+                             IBTK::LDataManager* l_data_manager);
+
     // Implementation of computeLagrangianForce.
+    //
+    // Candidate pairs are found using a cell-linked list built from the
+    // LNodeSetData on each patch, and each pair is visited only once by
+    // searching a half-shell of neighboring cells.  When Verlet lists are
+    // enabled (input key use_verlet_lists), only pairs separated by less than
+    // interaction_radius + verlet_skin are stored, and the list is rebuilt
+    // only when some node has moved more than half of verlet_skin since the
+    // list was built.
     void computeLagrangianForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> X_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> U_data,
@@ -90,6 +108,23 @@ private:
     // Assignment operator, not implemented.
     NonbondedForceEvaluator& operator=(const NonbondedForceEvaluator& that);
 
+    // Build the list of interacting pairs on the specified level of the
+    // patch hierarchy.
+    void buildPairList(const SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                       int level_number,
+                       IBTK::LDataManager* l_data_manager,
+                       const double* X_node,
+                       double list_radius,
+                       std::vector<int>& pair_idxs,
+                       std::vector<int>& pair_offsets) const;
+
+    // Accumulate the force between a pair of nodes.
+    void accumulatePairForce(int mstr_petsc_idx,
+                             int search_petsc_idx,
+                             const int* cell_offset,
+                             const double* X_node,
+                             double* F_node) const;
+
     // type of force to use:
     int d_force_type;
 
@@ -99,6 +134,19 @@ private:
     // regrid_alpha, for computing buffer to add to interactions:
     double d_regrid_alpha;
 
+    // whether to reuse Verlet lists, and the skin distance used to build them:
+    bool d_use_verlet_lists;
+    double d_verlet_skin;
+
+    // cached pair lists, stored separately for each level of the patch
+    // hierarchy.  For each pair, the PETSc indices of the master and search
+    // nodes are stored in d_pair_idxs and the periodic offset of the search
+    // node is stored in d_pair_offsets.  The positions of the nodes at the
+    // time the list was built are stored in d_X_ref.
+    std::vector<std::vector<int> > d_pair_idxs, d_pair_offsets;
+    std::vector<std::vector<double> > d_X_ref;
+    std::vector<bool> d_pair_list_is_valid;
+
     // parameters for force function:
     SAMRAI::tbox::Array<double> d_parameters;
 
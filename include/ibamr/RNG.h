@@ -1,11 +1,32 @@
 #ifndef included_IBAMR_RNG
 #define included_IBAMR_RNG
 
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ArrayData.h"
+#include "Box.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
 namespace IBAMR
 {
 /*!
  * \brief Class RNG organizes functions that provide random-number generator
  * functionality.
+ *
+ * Two generators are provided.  The first is a Mersenne Twister with a single
+ * per-process state (srandgen(), genrand(), and genrandn(double*)).  The
+ * sequence of values it produces depends on the order in which values are
+ * requested, and hence on the parallel decomposition of the computation.
+ *
+ * The second is the counter-based Philox4x32-10 generator of Salmon et al.
+ * (SC'11).  It keeps no state: each value is a function of the global seed
+ * and a counter, and can be computed independently of all other values.
+ * genrandn(ArrayData&, const Box&, ...) uses the global cell index, depth,
+ * level number, and a caller-specified stream number as the counter, and the
+ * global seed and time step number as the key.  The values generated for a
+ * particular cell are therefore independent of the number of MPI processes or
+ * threads and of the patch decomposition.
  */
 class RNG
 {
@@ -16,6 +37,19 @@ public:
 
     static void genrandn(double* result);
 
+    /*!
+     * \brief Fill the specified box of an array with standard normal random
+     * values generated by the counter-based generator.
+     *
+     * \note stream_num must be in the range [0,65535], level_num must be in the
+     * range [0,255], and the array depth must be at most 256.
+     */
+    static void genrandn(SAMRAI::pdat::ArrayData<NDIM, double>& data,
+                         const SAMRAI::hier::Box<NDIM>& box,
+                         int step_num,
+                         int level_num,
+                         int stream_num);
+
     static void parallel_seed(int global_seed);
 
 private:
@@ -23,7 +57,15 @@ private:
     RNG(RNG&);
     ~RNG();
     RNG& operator=(RNG&);
+
+    /*!
+     * Global seed for the counter-based generator.  This value is the same on
+     * all MPI processes.
+     */
+    static unsigned int s_counter_seed;
 };
 } // namespace IBAMR
 
+//////////////////////////////////////////////////////////////////////////////
+
 #endif //#ifndef included_IBAMR_RNG
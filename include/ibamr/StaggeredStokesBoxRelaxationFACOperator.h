@@ -39,10 +39,8 @@
 #include <string>
 #include <vector>
 
+#include "PoissonSpecifications.h"
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
-#include "petscksp.h"
-#include "petscmat.h"
-#include "petscvec.h"
 #include "tbox/Pointer.h"
 
 namespace boost
@@ -77,6 +75,19 @@ namespace IBAMR
  * \brief Class StaggeredStokesBoxRelaxationFACOperator is a concrete
  * StaggeredStokesFACPreconditionerStrategy implementing a box relaxation
  * (Vanka-type) smoother for use as a multigrid preconditioner.
+ *
+ * Each box consists of a single cell along with the side-centered velocities
+ * on its boundary.  The box operator depends only on the problem coefficients
+ * and the grid spacing, so its inverse is computed once per level when the
+ * operator state is initialized.
+ *
+ * The order in which the boxes are relaxed is set by the optional input key
+ * \p box_ordering.  With the default value \p "LEXICOGRAPHIC", boxes are
+ * relaxed in the order in which cells are stored on each patch.  With \p
+ * "MULTICOLOR", cells are colored so that boxes of the same color are
+ * independent of each other, and each color is relaxed in turn.  When the
+ * library is built with OpenMP, the boxes of each color are relaxed using
+ * multiple threads.
 */
 class StaggeredStokesBoxRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
 {
@@ -93,6 +104,16 @@ public:
      */
     ~StaggeredStokesBoxRelaxationFACOperator();
 
+    /*!
+     * \brief Reset the coefficients for the momentum equation without
+     * reinitializing the operator state.
+     *
+     * The inverses of the box operators are recomputed for the new
+     * coefficients, and the coarse level solver, if any, is updated via
+     * StaggeredStokesSolver::updateVelocityPoissonSpecifications().
+     */
+    bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
+
     /*!
      * \name Implementation of FACPreconditionerStrategy interface.
      */
@@ -164,11 +185,15 @@ private:
     StaggeredStokesBoxRelaxationFACOperator& operator=(const StaggeredStokesBoxRelaxationFACOperator& that);
 
     /*
-     * Box operator data.
+     * The ordering used to relax the boxes.
+     */
+    std::string d_box_ordering;
+
+    /*
+     * The inverse of the box operator on each level, stored in row-major
+     * order.
      */
-    std::vector<Mat> d_box_op;
-    std::vector<Vec> d_box_e, d_box_r;
-    std::vector<KSP> d_box_ksp;
+    std::vector<std::vector<double> > d_box_inv;
 
     /*
      * Mappings from patch indices to patch operators.
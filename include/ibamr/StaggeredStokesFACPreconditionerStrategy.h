@@ -133,6 +133,18 @@ public:
      */
     virtual void setVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
 
+    /*!
+     * \brief Reset the coefficients for the momentum equation without
+     * reinitializing the operator state.
+     *
+     * \return true if the operator state has been updated in place, or false if
+     * the operator state must be reinitialized before it is used.
+     *
+     * \note The default implementation calls setVelocityPoissonSpecifications()
+     * and returns false.
+     */
+    virtual bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
+
     /*!
      * \brief Set if velocity and pressure have nullspace.
      */
@@ -40,6 +40,7 @@
 
 #include "CellVariable.h"
 #include "IntVector.h"
+#include "PoissonSpecifications.h"
 #include "RefineSchedule.h"
 #include "SideVariable.h"
 #include "VariableContext.h"
@@ -100,6 +101,22 @@ public:
         return new StaggeredStokesPETScLevelSolver(object_name, input_db, default_options_prefix);
     } // allocate_solver
 
+    /*!
+     * \brief Update the problem coefficients used by the solver.
+     *
+     * If the solver is initialized, the values of the level matrix are
+     * recomputed in place, reusing its nonzero structure, the DOF indices, and
+     * the preconditioner subdomains, and the preconditioner is set up again.
+     * These data are regenerated only when the solver state is reinitialized,
+     * e.g., following a regrid operation.
+     *
+     * \note The shell preconditioner is not updated in place, and this method
+     * returns false if it is used.
+     *
+     * \see StaggeredStokesSolver::updateVelocityPoissonSpecifications()
+     */
+    bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
+
 protected:
     /*!
      * \brief Generate IS/subdomains for Schwartz type preconditioners.
@@ -89,6 +89,23 @@ public:
                                                int p_dof_index_idx,
                                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
 
+    /*!
+     * \brief Recompute the values of a parallel PETSc Mat object previously
+     * generated by constructPatchLevelMACStokesOp() without recomputing its
+     * nonzero structure.
+     *
+     * \note The DOF indices must not have changed since the matrix was
+     * constructed, i.e., the patch level must not have been regridded.
+     */
+    static void updatePatchLevelMACStokesOp(Mat& mat,
+                                            const SAMRAI::solv::PoissonSpecifications& u_problem_coefs,
+                                            const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+                                            double data_time,
+                                            const std::vector<int>& num_dofs_per_proc,
+                                            int u_dof_index_idx,
+                                            int p_dof_index_idx,
+                                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
     /*!
      * \brief Partition the patch level into subdomains suitable to be used for
      * additive Schwarz method.
@@ -162,6 +179,21 @@ private:
      * \return A reference to this object.
      */
     StaggeredStokesPETScMatUtilities& operator=(const StaggeredStokesPETScMatUtilities& that);
+
+    /*!
+     * \brief Implementation of constructPatchLevelMACStokesOp() and
+     * updatePatchLevelMACStokesOp().
+     */
+    static void
+    constructPatchLevelMACStokesOp_impl(Mat& mat,
+                                        bool reuse_nonzero_pattern,
+                                        const SAMRAI::solv::PoissonSpecifications& u_problem_coefs,
+                                        const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+                                        double data_time,
+                                        const std::vector<int>& num_dofs_per_proc,
+                                        int u_dof_index_idx,
+                                        int p_dof_index_idx,
+                                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
 };
 } // namespace IBAMR
 
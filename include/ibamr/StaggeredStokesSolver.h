@@ -79,6 +79,22 @@ public:
      */
     virtual void setVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
 
+    /*!
+     * \brief Reset the coefficients for the momentum equation of an
+     * initialized solver without reinitializing its solver state.
+     *
+     * This is intended for use when only the values of the coefficients have
+     * changed (e.g., because the time step size has changed), and the grid
+     * hierarchy and boundary conditions remain the same.
+     *
+     * \return true if the solver state has been updated in place, or false if
+     * the solver must be reinitialized before it is used.
+     *
+     * \note The default implementation calls setVelocityPoissonSpecifications()
+     * and returns false.
+     */
+    virtual bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
+
     /*!
      * \brief Set if velocity and pressure have nullspace.
      */
@@ -37,6 +37,7 @@
 #include <utility>
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
@@ -125,6 +126,40 @@ public:
     }
 };
 
+// Class to gather the per-structure quantities computed in one phase into a
+// single contiguous buffer so that they can be summed over all processes using
+// a single reduction.
+class PackedSumReduction
+{
+public:
+    void add(double* const data, const int n)
+    {
+        d_data.push_back(std::make_pair(data, n));
+        return;
+    }
+
+    void reduce()
+    {
+        std::vector<double> buffer;
+        for (std::vector<std::pair<double*, int> >::const_iterator cit = d_data.begin(); cit != d_data.end(); ++cit)
+        {
+            buffer.insert(buffer.end(), cit->first, cit->first + cit->second);
+        }
+        if (!buffer.empty()) SAMRAI_MPI::sumReduction(&buffer[0], static_cast<int>(buffer.size()));
+        std::vector<double>::const_iterator buffer_it = buffer.begin();
+        for (std::vector<std::pair<double*, int> >::const_iterator cit = d_data.begin(); cit != d_data.end(); ++cit)
+        {
+            std::copy(buffer_it, buffer_it + cit->second, cit->first);
+            buffer_it += cit->second;
+        }
+        d_data.clear();
+        return;
+    }
+
+private:
+    std::vector<std::pair<double*, int> > d_data;
+};
+
 template <typename itr, typename T>
 inline int
 find_struct_handle_position(itr begin, itr end, const T& value)
@@ -794,8 +829,6 @@ ConstraintIBMethod::getFromRestart()
 void
 ConstraintIBMethod::setInitialLagrangianVelocity()
 {
-    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
-
     const bool from_restart = RestartManager::getManager()->isFromRestart();
     if (!from_restart) calculateCOMandMOIOfStructures();
 
@@ -807,12 +840,13 @@ ConstraintIBMethod::setInitialLagrangianVelocity()
                                                           d_tagged_pt_position[struct_no]);
         d_ib_kinematics[struct_no]->setShape(d_FuRMoRP_current_time,
                                              d_incremented_angle_from_reference_axis[struct_no]);
+    }
 
-        if (!from_restart)
+    if (!from_restart)
+    {
+        calculateMomentumOfKinematicsVelocity();
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
         {
-            const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-            if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
-
             d_vel_com_def_current[struct_no] = d_vel_com_def_new[struct_no];
             d_omega_com_def_current[struct_no] = d_omega_com_def_new[struct_no];
         }
@@ -903,24 +937,25 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     }
 
+    PackedSumReduction com_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        com_reduction.add(&d_center_of_mass_current[struct_no][0], NDIM);
+        com_reduction.add(&d_center_of_mass_new[struct_no][0], NDIM);
+        com_reduction.add(&tagged_position[struct_no][0], 3);
+    }
+    com_reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         const int total_nodes = struct_param.getTotalNodes();
 
-        SAMRAI_MPI::sumReduction(&d_center_of_mass_current[struct_no][0], NDIM);
-        SAMRAI_MPI::sumReduction(&d_center_of_mass_new[struct_no][0], NDIM);
-
         for (int i = 0; i < 3; ++i)
         {
             d_center_of_mass_current[struct_no][i] /= total_nodes;
             d_center_of_mass_new[struct_no][i] /= total_nodes;
         }
-    }
-
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        SAMRAI_MPI::sumReduction(&tagged_position[struct_no][0], 3);
         d_tagged_pt_position[struct_no] = tagged_position[struct_no];
     }
 
@@ -1023,15 +1058,17 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     } // all levels
 
+    PackedSumReduction moi_reduction;
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
+            moi_reduction.add(&d_moment_of_inertia_current[struct_no](0, 0), 9);
+            moi_reduction.add(&d_moment_of_inertia_new[struct_no](0, 0), 9);
         }
     }
+    moi_reduction.reduce();
 
     // Fill-in symmetric part of inertia tensor.
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -1080,13 +1117,10 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
 void
 ConstraintIBMethod::calculateKinematicsVelocity()
 {
-    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
     const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
     // Theta_new = Theta_old + Omega_old*dt
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-
         for (int d = 0; d < 3; ++d)
             d_incremented_angle_from_reference_axis[struct_no][d] +=
                 (d_rigid_rot_vel_current[struct_no][d] - d_omega_com_def_current[struct_no][d]) * dt;
@@ -1097,76 +1131,73 @@ ConstraintIBMethod::calculateKinematicsVelocity()
                                                           d_tagged_pt_position[struct_no]);
 
         d_ib_kinematics[struct_no]->setShape(d_FuRMoRP_new_time, d_incremented_angle_from_reference_axis[struct_no]);
-
-        if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
     }
+    calculateMomentumOfKinematicsVelocity();
 
     return;
 } // calculateKinematicsVelocity
 
 void
-ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_handle)
+ConstraintIBMethod::calculateMomentumOfKinematicsVelocity()
 {
     typedef ConstraintIBKinematics::StructureParameters StructureParameters;
-    Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
-    const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-    Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
-    Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
-    const int coarsest_ln = struct_param.getCoarsestLevelNumber();
-    const int finest_ln = struct_param.getFinestLevelNumber();
-    const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
-    const int total_nodes = struct_param.getTotalNodes();
 
-    // Zero out linear momentum of kinematics velocity of the structure.
-    for (int d = 0; d < 3; ++d) d_vel_com_def_new[position_handle][d] = 0.0;
-
-    // Calculate linear momentum
-    for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size(); ++ln, ++itr)
+    // Accumulate the local contributions to the linear and angular momentum of
+    // all structures before summing them over all processes.
+    PackedSumReduction momentum_reduction;
+    for (int position_handle = 0; position_handle < d_no_structures; ++position_handle)
     {
+        Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
+        const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
+        if (!struct_param.getStructureIsSelfTranslating()) continue;
+
+        const int coarsest_ln = struct_param.getCoarsestLevelNumber();
+        const int finest_ln = struct_param.getFinestLevelNumber();
+        const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
+
+        // Zero out linear momentum of kinematics velocity of the structure.
+        for (int d = 0; d < 3; ++d) d_vel_com_def_new[position_handle][d] = 0.0;
+
+        // Calculate linear momentum
+        for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size();
+             ++ln, ++itr)
+        {
 #if !defined(NDEBUG)
-        TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
+            TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
 #endif
 
-        std::pair<int, int> lag_idx_range = range[itr];
-        const int offset = lag_idx_range.first;
-        double U_com_def[NDIM] = { 0.0 };
+            std::pair<int, int> lag_idx_range = range[itr];
+            const int offset = lag_idx_range.first;
+            double U_com_def[NDIM] = { 0.0 };
 
-        // Get LMesh corresponding to the present position of the structures
-        // on this level.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+            // Get LMesh corresponding to the present position of the structures
+            // on this level.
+            const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
+            const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+            const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
 
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-        {
-            const LNode* const node_idx = *cit;
-            const int lag_idx = node_idx->getLagrangianIndex();
-            if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
-                for (unsigned int d = 0; d < NDIM; ++d)
+                const LNode* const node_idx = *cit;
+                const int lag_idx = node_idx->getLagrangianIndex();
+                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
                 {
-                    U_com_def[d] += def_vel[d][lag_idx - offset];
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        U_com_def[d] += def_vel[d][lag_idx - offset];
+                    }
                 }
             }
+            for (int d = 0; d < NDIM; ++d)
+            {
+                d_vel_com_def_new[position_handle][d] += U_com_def[d];
+            }
         }
-        for (int d = 0; d < NDIM; ++d)
-        {
-            d_vel_com_def_new[position_handle][d] += U_com_def[d];
-        }
-    }
-    SAMRAI_MPI::sumReduction(&d_vel_com_def_new[position_handle][0], NDIM);
+        momentum_reduction.add(&d_vel_com_def_new[position_handle][0], NDIM);
 
-    for (int d = 0; d < 3; ++d)
-    {
-        if (calculate_trans_mom[d])
-            d_vel_com_def_new[position_handle][d] /= total_nodes;
-        else
-            d_vel_com_def_new[position_handle][d] = 0.0;
-    }
+        // Calculate angular momentum.
+        if (!struct_param.getStructureIsSelfRotating()) continue;
 
-    // Calculate angular momentum.
-    if (struct_param.getStructureIsSelfRotating())
-    {
         // Zero out angular momentum of kinematics velocity of the structure.
         for (int d = 0; d < 3; ++d) d_omega_com_def_new[position_handle][d] = 0.0;
 
@@ -1231,7 +1262,26 @@ ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_han
             }
             ptr_x_lag_data->restoreArrays();
         } // all levels
-        SAMRAI_MPI::sumReduction(&d_omega_com_def_new[position_handle][0], 3);
+        momentum_reduction.add(&d_omega_com_def_new[position_handle][0], 3);
+    } // all structs
+    momentum_reduction.reduce();
+
+    for (int position_handle = 0; position_handle < d_no_structures; ++position_handle)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[position_handle]->getStructureParameters();
+        if (!struct_param.getStructureIsSelfTranslating()) continue;
+
+        Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
+        const int total_nodes = struct_param.getTotalNodes();
+        for (int d = 0; d < 3; ++d)
+        {
+            if (calculate_trans_mom[d])
+                d_vel_com_def_new[position_handle][d] /= total_nodes;
+            else
+                d_vel_com_def_new[position_handle][d] = 0.0;
+        }
+
+        if (!struct_param.getStructureIsSelfRotating()) continue;
 
 // Find angular velocity of deformational velocity.
 #if (NDIM == 2)
@@ -1239,11 +1289,12 @@ ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_han
 #endif
 
 #if (NDIM == 3)
+        Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
         solveSystemOfEqns(d_omega_com_def_new[position_handle], d_moment_of_inertia_new[position_handle]);
         for (int d = 0; d < 3; ++d)
             if (!calculate_rot_mom[d]) d_omega_com_def_new[position_handle][d] = 0.0;
 #endif
-    } // if struct is rotating
+    }
 
     return;
 } // calculateMomentumOfKinematicsVelocity
@@ -1432,12 +1483,22 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
         d_l_data_U_interp[ln]->restoreArrays();
     } // all levels
 
+    PackedSumReduction trans_mom_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfTranslating())
+        {
+            trans_mom_reduction.add(&d_rigid_trans_vel_new[struct_no][0], NDIM);
+        }
+    }
+    trans_mom_reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfTranslating())
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_trans_vel_new[struct_no][0], NDIM);
             Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
             for (int d = 0; d < NDIM; ++d)
             {
@@ -1537,12 +1598,22 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
         d_l_data_X_half_Euler[ln]->restoreArrays();
     } // all levels
 
+    PackedSumReduction rot_mom_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfRotating())
+        {
+            rot_mom_reduction.add(&d_rigid_rot_vel_new[struct_no][0], 3);
+        }
+    }
+    rot_mom_reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
@@ -2319,10 +2390,16 @@ ConstraintIBMethod::calculateDrag()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    PackedSumReduction drag_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        drag_reduction.add(&inertia_force[struct_no][0], 3);
+        drag_reduction.add(&constraint_force[struct_no][0], 3);
+    }
+    drag_reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_force[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_force[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_force[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
@@ -2429,10 +2506,16 @@ ConstraintIBMethod::calculateTorque()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    PackedSumReduction torque_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        torque_reduction.add(&inertia_torque[struct_no][0], 3);
+        torque_reduction.add(&constraint_torque[struct_no][0], 3);
+    }
+    torque_reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_torque[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_torque[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_torque[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
@@ -2512,10 +2595,16 @@ ConstraintIBMethod::calculatePower()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    PackedSumReduction power_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        power_reduction.add(&inertia_power[struct_no][0], 3);
+        power_reduction.add(&constraint_power[struct_no][0], 3);
+    }
+    power_reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_power[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_power[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_power[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
@@ -44,6 +44,7 @@
 #include "ibamr/namespaces.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
+#include "tbox/MathUtilities.h"
 #include "petsc/private/petscimpl.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
@@ -250,6 +251,16 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
     d_petsc_mat_map[mat_name] = std::make_pair<Mat, Mat>(NULL, NULL);
     d_petsc_geometric_mat_map[mat_name] = NULL;
 
+    // The mobility of a rigid body does not change under rigid body motions,
+    // so the factorization of a single-structure matrix computed in the
+    // reference frame of its prototype structure remains valid.  Combined
+    // matrices for several structures are recomputed in the current
+    // configuration only if requested.
+    d_mat_recompute_map[mat_name] =
+        d_recompute_mob_mat && prototype_struct_ids.size() > 1 && mat_type != READ_FROM_FILE;
+    d_mat_factorized_map[mat_name] = false;
+    d_mat_dt_map[mat_name] = 0.0;
+
     // Allocate the actual matrices.
     const int mobility_mat_size = num_nodes * NDIM;
     const int body_mobility_mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
@@ -365,13 +376,14 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
         const int managing_proc = d_mat_proc_map[mat_name];
         const int mat_size = d_mat_nodes_map[mat_name] * data_depth;
         const int num_structs = static_cast<int>(struct_ids.size());
+        const bool use_reference_frame = !d_mat_recompute_map[mat_name];
 
         for (int k = 0; k < num_structs; ++k)
         {
             double* rhs = NULL;
             if (rank == managing_proc) rhs = new double[mat_size];
             d_cib_strategy->copyVecToArray(b, rhs, struct_ids[k], data_depth, managing_proc);
-            if (!d_recompute_mob_mat)
+            if (use_reference_frame)
             {
                 d_cib_strategy->rotateArray(rhs,
                                             struct_ids[k],
@@ -380,7 +392,7 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
                                             data_depth);
             }
             if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].first, rhs);
-            if (!d_recompute_mob_mat)
+            if (use_reference_frame)
             {
                 d_cib_strategy->rotateArray(rhs,
                                             struct_ids[k],
@@ -421,13 +433,14 @@ DirectMobilitySolver::solveBodySystem(Vec x, Vec b)
         const int mat_size = d_mat_parts_map[mat_name] * data_depth;
         const int managing_proc = d_mat_proc_map[mat_name];
         const int num_structs = static_cast<int>(struct_ids.size());
+        const bool use_reference_frame = !d_mat_recompute_map[mat_name];
 
         for (int k = 0; k < num_structs; ++k)
         {
             double* rhs = NULL;
             if (rank == managing_proc) rhs = new double[mat_size];
             d_cib_strategy->copyFreeDOFsVecToArray(b, rhs, struct_ids[k], managing_proc);
-            if (!d_recompute_mob_mat)
+            if (use_reference_frame)
             {
                 d_cib_strategy->rotateArray(rhs,
                                             struct_ids[k],
@@ -436,7 +449,7 @@ DirectMobilitySolver::solveBodySystem(Vec x, Vec b)
                                             data_depth);
             }
             if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].second, rhs);
-            if (!d_recompute_mob_mat)
+            if (use_reference_frame)
             {
                 d_cib_strategy->rotateArray(rhs,
                                             struct_ids[k],
@@ -461,14 +474,31 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
 
     IBAMR_TIMER_START(t_initialize_solver_state);
 
-    int rank = SAMRAI_MPI::getRank();
-    unsigned managed_mats = static_cast<unsigned>(d_mat_map.size());
-
-    static bool recreate_mobility_matrices = true;
-    static std::vector<bool> read_files(managed_mats, false);
-    bool initial_time = !d_recompute_mob_mat;
+    const int rank = SAMRAI_MPI::getRank();
+    const double dt = d_new_time - d_current_time;
+
+    // Determine which matrices need to be (re)factorized.  Factorizations
+    // computed in the reference frame of the prototype structures are reused;
+    // the right-hand sides and solutions are rotated into and out of that frame
+    // instead.  Empirical mobility matrices also depend on the time step size.
+    std::vector<std::string> factorize_mat_names;
+    bool first_factorization = true;
+    for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
+         it != d_petsc_mat_map.end();
+         ++it)
+    {
+        const std::string& mat_name = it->first;
+        const bool factorized = d_mat_factorized_map[mat_name];
+        const bool dt_changed = d_recompute_mob_mat && d_mat_type_map[mat_name] == EMPIRICAL &&
+                                !MathUtilities<double>::equalEps(dt, d_mat_dt_map[mat_name]);
+        if (!factorized || d_mat_recompute_map[mat_name] || dt_changed)
+        {
+            factorize_mat_names.push_back(mat_name);
+        }
+        if (factorized) first_factorization = false;
+    }
 
-    if (recreate_mobility_matrices)
+    if (!factorize_mat_names.empty())
     {
         // Get grid-info
         Vec* vx;
@@ -491,20 +521,20 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
             domain_extents[d] = X_upper[d] - X_lower[d];
         }
 
-        int file_counter = 0;
-        for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
-             it != d_petsc_mat_map.end();
-             ++it, ++file_counter)
+        for (std::vector<std::string>::const_iterator cit = factorize_mat_names.begin();
+             cit != factorize_mat_names.end();
+             ++cit)
         {
-            const std::string& mat_name = it->first;
+            const std::string& mat_name = *cit;
             Mat& mobility_mat = d_petsc_mat_map[mat_name].first;
             Mat& geometric_mat = d_petsc_geometric_mat_map[mat_name];
             const MobilityMatrixType& mat_type = d_mat_type_map[mat_name];
             const std::vector<unsigned>& struct_ids = d_mat_prototype_id_map[mat_name];
             const std::pair<double, double>& scale = d_mat_scale_map[mat_name];
             const int managing_proc = d_mat_proc_map[mat_name];
+            const bool initial_time = !d_mat_recompute_map[mat_name];
 
-            if (mat_type == READ_FROM_FILE && !read_files[file_counter])
+            if (mat_type == READ_FROM_FILE)
             {
                 // Get the matrix from file.
                 const std::string& filename = d_mat_filename_map[mat_name];
@@ -515,8 +545,6 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
                     MatLoad(mobility_mat, binary_viewer);
                     PetscViewerDestroy(&binary_viewer);
                 }
-
-                read_files[file_counter] = true;
             }
             else
             {
@@ -537,14 +565,17 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
             // Construct the geometric matrix that maps rigid body velocity to
             // nodal velocity.
             d_cib_strategy->constructGeometricMatrix(mat_name, geometric_mat, struct_ids, initial_time, managing_proc);
+
+            factorizeMobilityMatrix(mat_name);
+            constructBodyMobilityMatrix(mat_name);
+            factorizeBodyMobilityMatrix(mat_name);
+            d_mat_factorized_map[mat_name] = true;
+            d_mat_dt_map[mat_name] = dt;
         }
-        factorizeMobilityMatrix();
-        constructBodyMobilityMatrix();
-        factorizeBodyMobilityMatrix();
+        if (first_factorization) reportMemoryUsage();
     }
 
     d_is_initialized = true;
-    recreate_mobility_matrices = d_recompute_mob_mat;
 
     IBAMR_TIMER_STOP(t_initialize_solver_state);
 
@@ -600,94 +631,103 @@ DirectMobilitySolver::getFromInput(Pointer<Database> input_db)
 } // getFromInput
 
 void
-DirectMobilitySolver::factorizeMobilityMatrix()
+DirectMobilitySolver::factorizeMobilityMatrix(const std::string& mat_name)
 {
-    int rank = SAMRAI_MPI::getRank();
-    for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
-         it != d_petsc_mat_map.end();
-         ++it)
-    {
-        const std::string& mat_name = it->first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
+    const int rank = SAMRAI_MPI::getRank();
+    if (rank != d_mat_proc_map[mat_name]) return;
 
-        Mat& mat = d_petsc_mat_map[mat_name].first;
-        const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
-        const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
-        double* mat_data = NULL;
-        MatDenseGetArray(mat, &mat_data);
-        factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].first, mat_name, "Mobility");
-        MatDenseRestoreArray(mat, &mat_data);
-    }
+    Mat& mat = d_petsc_mat_map[mat_name].first;
+    const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
+    const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
+    double* mat_data = NULL;
+    MatDenseGetArray(mat, &mat_data);
+    factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].first, mat_name, "Mobility");
+    MatDenseRestoreArray(mat, &mat_data);
     return;
 
 } // factorizeMobilityMatrix
 
 void
-DirectMobilitySolver::constructBodyMobilityMatrix()
+DirectMobilitySolver::constructBodyMobilityMatrix(const std::string& mat_name)
 {
-    int rank = SAMRAI_MPI::getRank();
-    for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
-         it != d_petsc_mat_map.end();
-         ++it)
-    {
-        const std::string& mat_name = it->first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
+    const int rank = SAMRAI_MPI::getRank();
+    if (rank != d_mat_proc_map[mat_name]) return;
 
-        const int row_size = d_mat_nodes_map[mat_name] * NDIM;
-        const int col_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
-        const MobilityMatrixInverseType& mobility_inv_type = d_mat_inv_type_map[mat_name].first;
+    const int row_size = d_mat_nodes_map[mat_name] * NDIM;
+    const int col_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
+    const MobilityMatrixInverseType& mobility_inv_type = d_mat_inv_type_map[mat_name].first;
 
-        Mat& mobility_mat = d_petsc_mat_map[mat_name].first;
-        Mat& body_mob_mat = d_petsc_mat_map[mat_name].second;
-        Mat& geometric_mat = d_petsc_geometric_mat_map[mat_name];
+    Mat& mobility_mat = d_petsc_mat_map[mat_name].first;
+    Mat& body_mob_mat = d_petsc_mat_map[mat_name].second;
+    Mat& geometric_mat = d_petsc_geometric_mat_map[mat_name];
 
-        // Allocate a temporary matrix that holds the Matrix-Matrix product.
-        // Here we are multiplying inverse of mobility matrix with geometric matrix.
-        double* product_mat_data = new double[row_size * col_size];
-        Mat product_mat;
-        MatCreateSeqDense(PETSC_COMM_SELF, row_size, col_size, product_mat_data, &product_mat);
-        MatCopy(geometric_mat, product_mat, SAME_NONZERO_PATTERN);
-
-        for (int col = 0; col < col_size; ++col)
-        {
-            double* col_data;
-            MatDenseGetArray(product_mat, &col_data);
-            computeSolution(mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first, &col_data[col * row_size]);
-            MatDenseRestoreArray(product_mat, &col_data);
-        }
-        MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
+    // Allocate a temporary matrix that holds the Matrix-Matrix product.
+    // Here we are multiplying inverse of mobility matrix with geometric matrix.
+    double* product_mat_data = new double[row_size * col_size];
+    Mat product_mat;
+    MatCreateSeqDense(PETSC_COMM_SELF, row_size, col_size, product_mat_data, &product_mat);
+    MatCopy(geometric_mat, product_mat, SAME_NONZERO_PATTERN);
 
-        MatDestroy(&product_mat);
-        delete[] product_mat_data;
+    for (int col = 0; col < col_size; ++col)
+    {
+        double* col_data;
+        MatDenseGetArray(product_mat, &col_data);
+        computeSolution(mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first, &col_data[col * row_size]);
+        MatDenseRestoreArray(product_mat, &col_data);
     }
+    MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
+
+    MatDestroy(&product_mat);
+    delete[] product_mat_data;
 
     return;
 } // generateBodyFrictionMatrix
 
 void
-DirectMobilitySolver::factorizeBodyMobilityMatrix()
+DirectMobilitySolver::factorizeBodyMobilityMatrix(const std::string& mat_name)
 {
-    int rank = SAMRAI_MPI::getRank();
-    for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
-         it != d_petsc_mat_map.end();
-         ++it)
-    {
-        const std::string& mat_name = it->first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
+    const int rank = SAMRAI_MPI::getRank();
+    if (rank != d_mat_proc_map[mat_name]) return;
 
-        Mat& mat = d_petsc_mat_map[mat_name].second;
-        const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].second;
-        const int mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
+    Mat& mat = d_petsc_mat_map[mat_name].second;
+    const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].second;
+    const int mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
 
-        double* mat_data = NULL;
-        MatDenseGetArray(mat, &mat_data);
-        factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].second, mat_name, "Body Mobility");
-        MatDenseRestoreArray(mat, &mat_data);
-    }
+    double* mat_data = NULL;
+    MatDenseGetArray(mat, &mat_data);
+    factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].second, mat_name, "Body Mobility");
+    MatDenseRestoreArray(mat, &mat_data);
     return;
 
 } // factorizeBodyMobilityMatrix
 
+void
+DirectMobilitySolver::reportMemoryUsage() const
+{
+    const int rank = SAMRAI_MPI::getRank();
+    double local_bytes = 0.0;
+    plog << d_object_name << "::reportMemoryUsage():\n";
+    for (std::map<std::string, int>::const_iterator cit = d_mat_proc_map.begin(); cit != d_mat_proc_map.end(); ++cit)
+    {
+        const std::string& mat_name = cit->first;
+        if (rank != cit->second) continue;
+
+        const double mob_size = NDIM * d_mat_nodes_map.find(mat_name)->second;
+        const double body_mob_size = s_max_free_dofs * d_mat_parts_map.find(mat_name)->second;
+        const std::pair<int*, int*>& ipiv = d_ipiv_map.find(mat_name)->second;
+        double mat_bytes =
+            sizeof(double) * (mob_size * mob_size + body_mob_size * body_mob_size + mob_size * body_mob_size);
+        if (ipiv.first) mat_bytes += sizeof(int) * mob_size;
+        if (ipiv.second) mat_bytes += sizeof(int) * body_mob_size;
+        local_bytes += mat_bytes;
+        plog << "  matrix handle " << mat_name << ": " << mat_bytes / 1048576.0 << " MB\n";
+    }
+    const double total_bytes = SAMRAI_MPI::sumReduction(local_bytes);
+    plog << "  total on this process: " << local_bytes / 1048576.0 << " MB\n";
+    plog << "  total on all processes: " << total_bytes / 1048576.0 << " MB" << std::endl;
+    return;
+} // reportMemoryUsage
+
 void
 DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
                                            const int mat_size,
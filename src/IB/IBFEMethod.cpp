@@ -1600,7 +1600,16 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
         const hier::IntVector<NDIM>& ghost_width = d_fe_data_managers[part]->getGhostCellWidth();
         const Box<NDIM> spread_box = Box<NDIM>::grow(patch->getBox(), ghost_width);
         Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_data_idx);
-        LEInteractor::spread(f_data, T_bdry, NDIM, X_bdry, NDIM, patch, spread_box, spread_kernel_fcn);
+        LEInteractor::spread(f_data,
+                             T_bdry,
+                             NDIM,
+                             X_bdry,
+                             NDIM,
+                             patch,
+                             spread_box,
+                             spread_kernel_fcn,
+                             d_spread_spec.use_threaded_spreading,
+                             d_spread_spec.use_cell_sorted_kernels);
         if (f_phys_bdry_op)
         {
             f_phys_bdry_op->setPatchDataIndex(f_data_idx);
@@ -2300,6 +2309,10 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
         d_interp_spec.use_consistent_mass_matrix = db->getBool("interp_use_consistent_mass_matrix");
     else if (db->isBool("IB_use_consistent_mass_matrix"))
         d_interp_spec.use_consistent_mass_matrix = db->getBool("IB_use_consistent_mass_matrix");
+    if (db->isBool("interp_use_cell_sorted_kernels"))
+        d_interp_spec.use_cell_sorted_kernels = db->getBool("interp_use_cell_sorted_kernels");
+    else if (db->isBool("use_cell_sorted_kernels"))
+        d_interp_spec.use_cell_sorted_kernels = db->getBool("use_cell_sorted_kernels");
 
     // Spreading settings.
     if (db->isString("spread_delta_fcn"))
@@ -2328,6 +2341,14 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
         d_spread_spec.point_density = db->getDouble("spread_point_density");
     else if (db->isDouble("IB_point_density"))
         d_spread_spec.point_density = db->getDouble("IB_point_density");
+    if (db->isBool("spread_use_threaded_spreading"))
+        d_spread_spec.use_threaded_spreading = db->getBool("spread_use_threaded_spreading");
+    else if (db->isBool("use_threaded_spreading"))
+        d_spread_spec.use_threaded_spreading = db->getBool("use_threaded_spreading");
+    if (db->isBool("spread_use_cell_sorted_kernels"))
+        d_spread_spec.use_cell_sorted_kernels = db->getBool("spread_use_cell_sorted_kernels");
+    else if (db->isBool("use_cell_sorted_kernels"))
+        d_spread_spec.use_cell_sorted_kernels = db->getBool("use_cell_sorted_kernels");
 
     // Force computation settings.
     if (db->isBool("split_forces")) d_split_forces = db->getBool("split_forces");
@@ -38,14 +38,13 @@
 #include <algorithm>
 #include <fstream>
 #include <limits>
-#include <map>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "BasePatchLevel.h"
 #include "Box.h"
-#include "BoxArray.h"
+#include "BoxTree.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -57,6 +56,7 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "SideData.h"
 #include "SideIndex.h"
 #include "boost/array.hpp"
@@ -73,6 +73,7 @@
 #include "ibtk/LNode.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscvec.h"
+#include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
@@ -196,6 +197,16 @@ void init_meter_elements(boost::multi_array<Point, 2>& X_web,
     return;
 } // init_meter_elements
 
+// Return the number of the patch of the specified level whose box contains the
+// specified cell index, or -1 if the level does not cover that index.
+int
+find_patch_num(Pointer<PatchLevel<NDIM> > level, const Index<NDIM>& i)
+{
+    Array<int> patch_nums;
+    level->getBoxTree()->findOverlapIndices(patch_nums, Box<NDIM>(i, i));
+    return patch_nums.getSize() > 0 ? patch_nums[0] : -1;
+} // find_patch_num
+
 double
 compute_flow_correction(const boost::multi_array<Vector, 1>& U_perimeter,
                         const Vector& U_centroid,
@@ -528,8 +539,8 @@ IBInstrumentPanel::IBInstrumentPanel(const std::string& object_name, Pointer<Dat
       d_flow_values(),
       d_mean_pres_values(),
       d_point_pres_values(),
-      d_web_patch_map(),
-      d_web_centroid_map(),
+      d_web_patches(),
+      d_web_centroids(),
       d_plot_directory_name(NDIM == 2 ? "viz_inst2d" : "viz_inst3d"),
       d_output_log_file(false),
       d_log_file_name(NDIM == 2 ? "inst2d.log" : "inst3d.log"),
@@ -878,10 +889,15 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
     // located.  Similarly, each web centroid is assigned to which ever grid
     // cell is the finest cell that contains the region of physical space in
     // which the web centroid is located.
-    d_web_patch_map.clear();
-    d_web_patch_map.resize(finest_ln + 1);
-    d_web_centroid_map.clear();
-    d_web_centroid_map.resize(finest_ln + 1);
+    //
+    // Only the web patches and centroids that are assigned to cells of local
+    // patches are stored.  They are indexed by level number and patch number,
+    // so that reading the instruments only visits the cells that contain web
+    // data.
+    d_web_patches.clear();
+    d_web_patches.resize(finest_ln + 1);
+    d_web_centroids.clear();
+    d_web_centroids.resize(finest_ln + 1);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
@@ -907,6 +923,14 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
             finer_dx[d] = dx_coarsest[d] / static_cast<double>(finer_ratio(d));
         }
 
+        // Assign the web patches and centroids to the cells of this level that
+        // are not covered by the next finer level.  The patch that contains
+        // each cell is found with the box tree of the level, so that each web
+        // point is binned in a single pass, and only those points that are
+        // assigned to local patches are stored.
+        const ProcessorMapping& processor_mapping = level->getProcessorMapping();
+        d_web_patches[ln].resize(level->getNumberOfPatches());
+        d_web_centroids[ln].resize(level->getNumberOfPatches());
         for (unsigned int l = 0; l < d_num_meters; ++l)
         {
             // Setup the web patch mapping.
@@ -917,20 +941,22 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
                     const Point& X = d_X_web[l][m][n];
                     const Index<NDIM> i = IndexUtilities::getCellIndex(
                         X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
+                    const int patch_num = find_patch_num(level, i);
+                    if (patch_num < 0 || !processor_mapping.isMappingLocal(patch_num)) continue;
                     const Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
                                                                              domainXLower,
                                                                              domainXUpper,
                                                                              finer_dx.data(),
                                                                              finer_domain_box_level_lower,
                                                                              finer_domain_box_level_upper);
-                    if (level->getBoxes().contains(i) &&
-                        (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
+                    if (ln == finest_ln || find_patch_num(finer_level, finer_i) < 0)
                     {
                         WebPatch p;
+                        p.cell_idx = i;
                         p.meter_num = l;
                         p.X = &d_X_web[l][m][n];
                         p.dA = &d_dA_web[l][m][n];
-                        d_web_patch_map[ln].insert(std::make_pair(i, p));
+                        d_web_patches[ln][patch_num].push_back(p);
                     }
                 }
             }
@@ -939,18 +965,21 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
             const Point& X = d_X_centroid[l];
             const Index<NDIM> i = IndexUtilities::getCellIndex(
                 X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
+            const int patch_num = find_patch_num(level, i);
+            if (patch_num < 0 || !processor_mapping.isMappingLocal(patch_num)) continue;
             const Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
                                                                      domainXLower,
                                                                      domainXUpper,
                                                                      finer_dx.data(),
                                                                      finer_domain_box_level_lower,
                                                                      finer_domain_box_level_upper);
-            if (level->getBoxes().contains(i) && (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
+            if (ln == finest_ln || find_patch_num(finer_level, finer_i) < 0)
             {
                 WebCentroid c;
+                c.cell_idx = i;
                 c.meter_num = l;
                 c.X = &d_X_centroid[l];
-                d_web_centroid_map[ln].insert(std::make_pair(i, c));
+                d_web_centroids[ln][patch_num].push_back(c);
             }
         }
     }
@@ -1009,6 +1038,10 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
+            const std::vector<WebPatch>& patch_web_patches = d_web_patches[ln][p()];
+            const std::vector<WebCentroid>& patch_web_centroids = d_web_centroids[ln][p()];
+            if (patch_web_patches.empty() && patch_web_centroids.empty()) continue;
+
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             const Box<NDIM>& patch_box = patch->getBox();
             const Index<NDIM>& patch_lower = patch_box.lower();
@@ -1023,99 +1056,64 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
 
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            for (std::vector<WebPatch>::const_iterator it = patch_web_patches.begin(); it != patch_web_patches.end();
+                 ++it)
             {
-                const Index<NDIM>& i = b();
-                std::pair<WebPatchMap::const_iterator, WebPatchMap::const_iterator> patch_range =
-                    d_web_patch_map[ln].equal_range(i);
-                if (patch_range.first != patch_range.second)
-                {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
+                const Index<NDIM>& i = it->cell_idx;
+                const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
+                                   x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
 #if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
+                                       ,
+                                   x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
 #endif
-                                           );
-                    if (U_cc_data)
-                    {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (U_sc_data)
-                    {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (P_cc_data)
-                    {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pres_values[meter_num] += P * dA.norm();
-                            A[meter_num] += dA.norm();
-                        }
-                    }
+                                       );
+                const int& meter_num = it->meter_num;
+                const Point& X = *(it->X);
+                const Vector& dA = *(it->dA);
+                if (U_cc_data)
+                {
+                    const Vector U =
+                        linear_interp<NDIM>(X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_flow_values[meter_num] += U.dot(dA);
                 }
-
-                std::pair<WebCentroidMap::const_iterator, WebCentroidMap::const_iterator> centroid_range =
-                    d_web_centroid_map[ln].equal_range(i);
-                if (centroid_range.first != centroid_range.second)
+                if (U_sc_data)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
+                    const Vector U =
+                        linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_flow_values[meter_num] += U.dot(dA);
+                }
+                if (P_cc_data)
+                {
+                    double P = linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_mean_pres_values[meter_num] += P * dA.norm();
+                    A[meter_num] += dA.norm();
+                }
+            }
+
+            for (std::vector<WebCentroid>::const_iterator it = patch_web_centroids.begin();
+                 it != patch_web_centroids.end();
+                 ++it)
+            {
+                const Index<NDIM>& i = it->cell_idx;
+                const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
+                                   x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
 #if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
+                                       ,
+                                   x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
 #endif
-                                           );
-                    if (P_cc_data)
-                    {
-                        for (WebCentroidMap::const_iterator it = centroid_range.first; it != centroid_range.second;
-                             ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_point_pres_values[meter_num] = P;
-                        }
-                    }
+                                       );
+                if (P_cc_data)
+                {
+                    const int& meter_num = it->meter_num;
+                    const Point& X = *(it->X);
+                    const double P =
+                        linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_point_pres_values[meter_num] = P;
                 }
             }
         }
     }
 
-    // Synchronize the values across all processes.
-    SAMRAI_MPI::sumReduction(&d_flow_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_mean_pres_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_point_pres_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&A[0], d_num_meters);
-
-    // Normalize the mean pressure.
-    for (unsigned int m = 0; m < d_num_meters; ++m)
-    {
-        d_mean_pres_values[m] /= A[m];
-    }
-
     // Loop over all local nodes to determine the velocities of the local
     // perimeter nodes.
     std::vector<boost::multi_array<Vector, 1> > U_perimeter(d_num_meters);
@@ -1161,26 +1159,46 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
         }
     }
 
-    // Set the velocities of all perimeter nodes on all processes.
-    std::vector<double> U_perimeter_flattened;
+    // Synchronize the meter values and the velocities of all perimeter nodes
+    // across all processes with a single reduction.
+    std::vector<double> reduction_data;
+    reduction_data.reserve(4 * d_num_meters);
+    reduction_data.insert(reduction_data.end(), d_flow_values.begin(), d_flow_values.end());
+    reduction_data.insert(reduction_data.end(), d_mean_pres_values.begin(), d_mean_pres_values.end());
+    reduction_data.insert(reduction_data.end(), d_point_pres_values.begin(), d_point_pres_values.end());
+    reduction_data.insert(reduction_data.end(), A.begin(), A.end());
     for (unsigned int m = 0; m < d_num_meters; ++m)
     {
         for (int n = 0; n < d_num_perimeter_nodes[m]; ++n)
         {
-            U_perimeter_flattened.insert(
-                U_perimeter_flattened.end(), U_perimeter[m][n].data(), U_perimeter[m][n].data() + NDIM);
+            reduction_data.insert(reduction_data.end(), U_perimeter[m][n].data(), U_perimeter[m][n].data() + NDIM);
         }
     }
-    SAMRAI_MPI::sumReduction(&U_perimeter_flattened[0], static_cast<int>(U_perimeter_flattened.size()));
-    for (unsigned int m = 0, k = 0; m < d_num_meters; ++m)
+    SAMRAI_MPI::sumReduction(&reduction_data[0], static_cast<int>(reduction_data.size()));
+    std::vector<double>::const_iterator reduction_it = reduction_data.begin();
+    std::copy(reduction_it, reduction_it + d_num_meters, d_flow_values.begin());
+    reduction_it += d_num_meters;
+    std::copy(reduction_it, reduction_it + d_num_meters, d_mean_pres_values.begin());
+    reduction_it += d_num_meters;
+    std::copy(reduction_it, reduction_it + d_num_meters, d_point_pres_values.begin());
+    reduction_it += d_num_meters;
+    std::copy(reduction_it, reduction_it + d_num_meters, A.begin());
+    reduction_it += d_num_meters;
+    for (unsigned int m = 0; m < d_num_meters; ++m)
     {
-        for (int n = 0; n < d_num_perimeter_nodes[m]; ++n, ++k)
+        for (int n = 0; n < d_num_perimeter_nodes[m]; ++n)
         {
-            std::copy(
-                &U_perimeter_flattened[NDIM * k], (&U_perimeter_flattened[NDIM * k]) + NDIM, U_perimeter[m][n].data());
+            std::copy(reduction_it, reduction_it + NDIM, U_perimeter[m][n].data());
+            reduction_it += NDIM;
         }
     }
 
+    // Normalize the mean pressure.
+    for (unsigned int m = 0; m < d_num_meters; ++m)
+    {
+        d_mean_pres_values[m] /= A[m];
+    }
+
     // Determine the velocity of the centroid of each perimeter.
     std::vector<Vector> U_centroid(d_num_meters, Vector::Zero());
     for (unsigned int m = 0; m < d_num_meters; ++m)
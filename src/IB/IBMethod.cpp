@@ -75,6 +75,8 @@
 #include "ibamr/IBLagrangianSourceStrategy.h"
 #include "ibamr/IBMethod.h"
 #include "ibamr/IBMethodPostProcessStrategy.h"
+#include "ibamr/IBSpringForceSpec.h"
+#include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/IBTK_CHKERRQ.h"
@@ -98,6 +100,8 @@
 #include "tbox/Pointer.h"
 #include "tbox/RestartManager.h"
 #include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 namespace IBTK
@@ -135,8 +139,19 @@ cos_kernel(const double x, const double eps)
     }
 } // cos_kernel
 
+// Count the springs associated with a node for workload estimation.
+int
+count_springs(const LNode& node, void* /*ctx*/)
+{
+    const IBSpringForceSpec* const force_spec = node.getNodeDataItem<IBSpringForceSpec>();
+    return force_spec ? static_cast<int>(force_spec->getNumberOfSprings()) : 0;
+} // count_springs
+
 // Version of IBMethod restart file data.
 static const int IB_METHOD_VERSION = 1;
+
+// Timers.
+static Timer* t_compute_lagrangian_force;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -165,6 +180,11 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     // Set some default values.
     d_interp_kernel_fcn = "IB_4";
     d_spread_kernel_fcn = "IB_4";
+    d_use_threaded_spreading = false;
+    d_use_cell_sorted_kernels = false;
+    d_use_measured_workload_estimates = false;
+    d_workload_force_timer_names.push_back("IBAMR::IBMethod::computeLagrangianForce()");
+    d_use_incremental_data_redistribution = false;
     d_error_if_points_leave_domain = false;
     d_ghosts = std::max(LEInteractor::getMinimumGhostWidth(d_interp_kernel_fcn),
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
@@ -194,6 +214,17 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setUseThreadedSpreading(d_use_threaded_spreading);
+    d_l_data_manager->setUseCellSortedKernels(d_use_cell_sorted_kernels);
+    if (d_use_measured_workload_estimates)
+    {
+        d_l_data_manager->setUseMeasuredWorkloadEstimates(d_use_measured_workload_estimates,
+                                                          d_workload_marker_timer_names,
+                                                          d_workload_force_timer_names,
+                                                          d_workload_eul_timer_names);
+        d_l_data_manager->registerSpringCountCallback(&count_springs);
+    }
+    d_l_data_manager->setUseIncrementalDataRedistribution(d_use_incremental_data_redistribution);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -219,6 +250,10 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
 
     // Indicate that the Jacobian matrix has not been allocated.
     d_force_jac = NULL;
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(t_compute_lagrangian_force =
+                      TimerManager::getManager()->getTimer("IBAMR::IBMethod::computeLagrangianForce()"););
     return;
 } // IBMethod
 
@@ -844,6 +879,7 @@ IBMethod::hasFluidSources() const
 void
 IBMethod::computeLagrangianForce(const double data_time)
 {
+    IBAMR_TIMER_START(t_compute_lagrangian_force);
     int ierr;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -864,6 +900,7 @@ IBMethod::computeLagrangianForce(const double data_time)
         }
     }
     *F_needs_ghost_fill = true;
+    IBAMR_TIMER_STOP(t_compute_lagrangian_force);
     return;
 } // computeLagrangianForce
 
@@ -2066,6 +2103,30 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
         if (db->isBool("normalize_source_strength"))
             d_normalize_source_strength = db->getBool("normalize_source_strength");
     }
+    if (db->keyExists("use_threaded_spreading")) d_use_threaded_spreading = db->getBool("use_threaded_spreading");
+    if (db->keyExists("use_cell_sorted_kernels")) d_use_cell_sorted_kernels = db->getBool("use_cell_sorted_kernels");
+    if (db->keyExists("use_measured_workload_estimates"))
+        d_use_measured_workload_estimates = db->getBool("use_measured_workload_estimates");
+    if (db->keyExists("workload_marker_timer_names"))
+    {
+        Array<std::string> timer_names = db->getStringArray("workload_marker_timer_names");
+        d_workload_marker_timer_names.resize(timer_names.size());
+        for (int k = 0; k < timer_names.size(); ++k) d_workload_marker_timer_names[k] = timer_names[k];
+    }
+    if (db->keyExists("workload_force_timer_names"))
+    {
+        Array<std::string> timer_names = db->getStringArray("workload_force_timer_names");
+        d_workload_force_timer_names.resize(timer_names.size());
+        for (int k = 0; k < timer_names.size(); ++k) d_workload_force_timer_names[k] = timer_names[k];
+    }
+    if (db->keyExists("workload_eulerian_timer_names"))
+    {
+        Array<std::string> timer_names = db->getStringArray("workload_eulerian_timer_names");
+        d_workload_eul_timer_names.resize(timer_names.size());
+        for (int k = 0; k < timer_names.size(); ++k) d_workload_eul_timer_names[k] = timer_names[k];
+    }
+    if (db->keyExists("use_incremental_data_redistribution"))
+        d_use_incremental_data_redistribution = db->getBool("use_incremental_data_redistribution");
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
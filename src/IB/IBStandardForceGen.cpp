@@ -44,6 +44,10 @@
 #include <utility>
 #include <vector>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 #include "IntVector.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
@@ -74,6 +78,10 @@ namespace IBAMR
 
 namespace
 {
+// Number of force elements (springs, beams, or target points) that are
+// processed together in a single batch.
+static const int FORCE_BATCH_SIZE = 64;
+
 void
 resetLocalPETScIndices(std::vector<int>& inds, const int global_node_offset, const int num_local_nodes)
 {
@@ -130,17 +138,31 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
 IBStandardForceGen::IBStandardForceGen(Pointer<Database> input_db)
 {
     // Setup the default force generation functions.
-    registerSpringForceFunction(0, &default_spring_force, &default_spring_force_deriv);
+    registerSpringForceFunction(0, &default_spring_force, &default_spring_force_deriv, &default_spring_force_batch);
 
     // Set some default values.
     d_log_target_point_displacements = false;
+    d_num_threads = 1;
 
     // Set up force generator from input.
     if (input_db)
     {
         if (input_db->keyExists("log_target_point_displacements"))
             d_log_target_point_displacements = input_db->getBool("log_target_point_displacements");
+        if (input_db->keyExists("num_threads")) d_num_threads = input_db->getInteger("num_threads");
+    }
+#if !defined(_OPENMP)
+    if (d_num_threads > 1)
+    {
+        TBOX_WARNING("IBStandardForceGen::IBStandardForceGen():\n"
+                     << "  num_threads = "
+                     << d_num_threads
+                     << " was specified, but IBAMR was not configured with --enable-openmp.\n"
+                     << "  forces will be computed using a single thread."
+                     << std::endl);
+        d_num_threads = 1;
     }
+#endif
     return;
 } // IBStandardForceGen
 
@@ -153,10 +175,18 @@ IBStandardForceGen::~IBStandardForceGen()
 void
 IBStandardForceGen::registerSpringForceFunction(const int force_fcn_index,
                                                 const SpringForceFcnPtr spring_force_fcn_ptr,
-                                                const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr)
+                                                const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr,
+                                                const SpringForceBatchFcnPtr spring_force_batch_fcn_ptr,
+                                                const int spring_force_batch_num_params)
 {
+#if !defined(NDEBUG)
+    TBOX_ASSERT(spring_force_batch_num_params >= 0);
+#endif
     d_spring_force_fcn_map[force_fcn_index] = spring_force_fcn_ptr;
     d_spring_force_deriv_fcn_map[force_fcn_index] = spring_force_deriv_fcn_ptr;
+    d_spring_force_batch_fcn_map[force_fcn_index] = spring_force_batch_fcn_ptr;
+    d_spring_force_batch_num_params_map[force_fcn_index] =
+        spring_force_batch_fcn_ptr ? spring_force_batch_num_params : 0;
     return;
 } // registerSpringForceFunction
 
@@ -296,6 +326,9 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
                    d_target_point_data[level_number].petsc_global_node_idxs.begin(),
                    std::bind2nd(std::multiplies<int>(), NDIM));
 
+    // Group the springs by force function.
+    initializeSpringForceGroups(level_number);
+
     // Indicate that the level data has been initialized.
     d_is_initialized[level_number] = true;
     return;
@@ -775,6 +808,8 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     std::vector<int>& petsc_slave_node_idxs = d_spring_data[level_number].petsc_slave_node_idxs;
     std::vector<int>& petsc_global_mastr_node_idxs = d_spring_data[level_number].petsc_global_mastr_node_idxs;
     std::vector<int>& petsc_global_slave_node_idxs = d_spring_data[level_number].petsc_global_slave_node_idxs;
+    std::vector<int>& force_fcn_idxs = d_spring_data[level_number].force_fcn_idxs;
+    std::vector<int>& num_parameters = d_spring_data[level_number].num_parameters;
     std::vector<SpringForceFcnPtr>& force_fcns = d_spring_data[level_number].force_fcns;
     std::vector<SpringForceDerivFcnPtr>& force_deriv_fcns = d_spring_data[level_number].force_deriv_fcns;
     std::vector<const double*>& parameters = d_spring_data[level_number].parameters;
@@ -800,6 +835,8 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     petsc_slave_node_idxs.resize(num_springs);
     petsc_global_mastr_node_idxs.resize(num_springs);
     petsc_global_slave_node_idxs.resize(num_springs);
+    force_fcn_idxs.resize(num_springs);
+    num_parameters.resize(num_springs);
     force_fcns.resize(num_springs);
     force_deriv_fcns.resize(num_springs);
     parameters.resize(num_springs);
@@ -831,6 +868,8 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
             lag_mastr_node_idxs[current_spring] = lag_idx;
             lag_slave_node_idxs[current_spring] = slv[k];
             petsc_mastr_node_idxs[current_spring] = petsc_idx;
+            force_fcn_idxs[current_spring] = fcn[k];
+            num_parameters[current_spring] = params.empty() ? 0 : static_cast<int>(params[k].size());
             force_fcns[current_spring] = d_spring_force_fcn_map[fcn[k]];
             force_deriv_fcns[current_spring] = d_spring_force_deriv_fcn_map[fcn[k]];
             parameters[current_spring] = params.empty() ? NULL : &params[k][0];
@@ -863,6 +902,61 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     return;
 } // initializeSpringLevelData
 
+void
+IBStandardForceGen::initializeSpringForceGroups(const int level_number)
+{
+    SpringData& spring_data = d_spring_data[level_number];
+    std::vector<SpringForceGroup>& force_groups = spring_data.force_groups;
+    force_groups.clear();
+
+    // Determine the springs that use each force function.  Within each group,
+    // springs are ordered by the PETSc index of the master node to improve the
+    // locality of the accesses to the position and force data.
+    std::map<int, std::vector<std::pair<int, int> > > group_springs;
+    const int num_springs = static_cast<int>(spring_data.lag_mastr_node_idxs.size());
+    for (int k = 0; k < num_springs; ++k)
+    {
+        group_springs[spring_data.force_fcn_idxs[k]].push_back(std::make_pair(spring_data.petsc_mastr_node_idxs[k], k));
+    }
+
+    // Setup the data structures for each group of springs.
+    force_groups.resize(group_springs.size());
+    int current_group = 0;
+    for (std::map<int, std::vector<std::pair<int, int> > >::iterator it = group_springs.begin();
+         it != group_springs.end();
+         ++it, ++current_group)
+    {
+        const int force_fcn_idx = it->first;
+        std::vector<std::pair<int, int> >& springs = it->second;
+        std::sort(springs.begin(), springs.end());
+        const unsigned int num_group_springs = static_cast<unsigned int>(springs.size());
+
+        SpringForceGroup& group = force_groups[current_group];
+        group.force_fcn = d_spring_force_fcn_map[force_fcn_idx];
+        group.force_batch_fcn = d_spring_force_batch_fcn_map[force_fcn_idx];
+        group.force_batch_num_parameters = d_spring_force_batch_num_params_map[force_fcn_idx];
+        group.max_num_parameters = 0;
+        group.lag_mastr_node_idxs.resize(num_group_springs);
+        group.lag_slave_node_idxs.resize(num_group_springs);
+        group.petsc_mastr_node_idxs.resize(num_group_springs);
+        group.petsc_slave_node_idxs.resize(num_group_springs);
+        group.num_parameters.resize(num_group_springs);
+        group.parameters.resize(num_group_springs);
+        for (unsigned int j = 0; j < num_group_springs; ++j)
+        {
+            const int k = springs[j].second;
+            group.lag_mastr_node_idxs[j] = spring_data.lag_mastr_node_idxs[k];
+            group.lag_slave_node_idxs[j] = spring_data.lag_slave_node_idxs[k];
+            group.petsc_mastr_node_idxs[j] = spring_data.petsc_mastr_node_idxs[k];
+            group.petsc_slave_node_idxs[j] = spring_data.petsc_slave_node_idxs[k];
+            group.num_parameters[j] = spring_data.num_parameters[k];
+            group.parameters[j] = spring_data.parameters[k];
+            group.max_num_parameters = std::max(group.max_num_parameters, spring_data.num_parameters[k]);
+        }
+    }
+    return;
+} // initializeSpringForceGroups
+
 void
 IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                  Pointer<LData> X_data,
@@ -871,108 +965,118 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                  const double /*data_time*/,
                                                  LDataManager* const /*l_data_manager*/)
 {
-    const int num_springs = static_cast<int>(d_spring_data[level_number].lag_mastr_node_idxs.size());
-    if (num_springs == 0) return;
-    const int* const lag_mastr_node_idxs = &d_spring_data[level_number].lag_mastr_node_idxs[0];
-    const int* const lag_slave_node_idxs = &d_spring_data[level_number].lag_slave_node_idxs[0];
-    const int* const petsc_mastr_node_idxs = &d_spring_data[level_number].petsc_mastr_node_idxs[0];
-    const int* const petsc_slave_node_idxs = &d_spring_data[level_number].petsc_slave_node_idxs[0];
-    const SpringForceFcnPtr* const force_fcns = &d_spring_data[level_number].force_fcns[0];
-    const double** const parameters = &d_spring_data[level_number].parameters[0];
+    const std::vector<SpringForceGroup>& force_groups = d_spring_data[level_number].force_groups;
+    if (force_groups.empty()) return;
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+    const int num_values = NDIM * static_cast<int>(F_data->getLocalNodeCount() + F_data->getGhostNodeCount());
+    const int num_threads = initializeThreadForceData(num_values);
 
-    static const int BLOCKSIZE = 16; // this parameter needs to be tuned
-    int k, kblock, kunroll, mastr_idx, slave_idx;
-    double F[NDIM], D[NDIM], R, T_over_R;
-    kblock = 0;
-    for (; kblock < (num_springs - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
-    {
-        PREFETCH_READ_NTA_BLOCK(lag_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(lag_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(force_fcns + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(parameters + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
-        {
-            k = kblock * BLOCKSIZE + kunroll;
-            mastr_idx = petsc_mastr_node_idxs[k];
-            slave_idx = petsc_slave_node_idxs[k];
-#if !defined(NDEBUG)
-            TBOX_ASSERT(mastr_idx != slave_idx);
-#endif
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(parameters[k + 1]);
-            D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-            D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
-#if (NDIM == 3)
-            D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
-#endif
-#if (NDIM == 2)
-            R = sqrt(D[0] * D[0] + D[1] * D[1]);
-#endif
-#if (NDIM == 3)
-            R = sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
-#endif
-            if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-            T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-            F[0] = T_over_R * D[0];
-            F[1] = T_over_R * D[1];
-#if (NDIM == 3)
-            F[2] = T_over_R * D[2];
+    // Springs are processed in batches.  For each batch, the displacements are
+    // gathered into structure-of-arrays form, the tension forces are evaluated
+    // for the entire batch, and the resulting forces are scattered to the
+    // nodes.
+    //
+    // When multiple threads are used, the batches are distributed among the
+    // threads, and each thread other than the first accumulates forces in its
+    // own array.  These arrays are summed once all of the batches have been
+    // processed.
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(num_threads)
 #endif
-            F_node[mastr_idx + 0] += F[0];
-            F_node[mastr_idx + 1] += F[1];
-#if (NDIM == 3)
-            F_node[mastr_idx + 2] += F[2];
+    {
+        double* F_acc = F_node;
+#if defined(_OPENMP)
+        const int thread_num = omp_get_thread_num();
+        if (thread_num > 0) F_acc = &d_F_thread_data[thread_num - 1][0];
 #endif
-            F_node[slave_idx + 0] -= F[0];
-            F_node[slave_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[slave_idx + 2] -= F[2];
+        double D[NDIM][FORCE_BATCH_SIZE], R[FORCE_BATCH_SIZE], T[FORCE_BATCH_SIZE];
+        std::vector<double> params;
+        for (std::vector<SpringForceGroup>::const_iterator it = force_groups.begin(); it != force_groups.end(); ++it)
+        {
+            const SpringForceGroup& group = *it;
+            const int num_springs = static_cast<int>(group.petsc_mastr_node_idxs.size());
+            const int num_batches = (num_springs + FORCE_BATCH_SIZE - 1) / FORCE_BATCH_SIZE;
+            const int num_params = std::max(group.max_num_parameters, group.force_batch_num_parameters);
+            params.resize(std::max(num_params * FORCE_BATCH_SIZE, 1));
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
 #endif
-        }
-    }
-    for (k = kblock * BLOCKSIZE; k < num_springs; ++k)
-    {
-        mastr_idx = petsc_mastr_node_idxs[k];
-        slave_idx = petsc_slave_node_idxs[k];
+            for (int batch = 0; batch < num_batches; ++batch)
+            {
+                const int k_start = batch * FORCE_BATCH_SIZE;
+                const int batch_size = std::min(FORCE_BATCH_SIZE, num_springs - k_start);
+                const int* const lag_mastr_node_idxs = &group.lag_mastr_node_idxs[k_start];
+                const int* const lag_slave_node_idxs = &group.lag_slave_node_idxs[k_start];
+                const int* const petsc_mastr_node_idxs = &group.petsc_mastr_node_idxs[k_start];
+                const int* const petsc_slave_node_idxs = &group.petsc_slave_node_idxs[k_start];
+                const double* const* const parameters = &group.parameters[k_start];
+
+                // Gather the displacements.
+                for (int k = 0; k < batch_size; ++k)
+                {
+                    const int mastr_idx = petsc_mastr_node_idxs[k];
+                    const int slave_idx = petsc_slave_node_idxs[k];
 #if !defined(NDEBUG)
-        TBOX_ASSERT(mastr_idx != slave_idx);
-#endif
-        D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-        D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
-#if (NDIM == 3)
-        D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
+                    TBOX_ASSERT(mastr_idx != slave_idx);
 #endif
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        D[d][k] = X_node[slave_idx + d] - X_node[mastr_idx + d];
+                    }
+                }
+                for (int k = 0; k < batch_size; ++k)
+                {
 #if (NDIM == 2)
-        R = sqrt(D[0] * D[0] + D[1] * D[1]);
-#endif
-#if (NDIM == 3)
-        R = sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
-#endif
-        if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-        T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-        F[0] = T_over_R * D[0];
-        F[1] = T_over_R * D[1];
-#if (NDIM == 3)
-        F[2] = T_over_R * D[2];
+                    R[k] = sqrt(D[0][k] * D[0][k] + D[1][k] * D[1][k]);
 #endif
-        F_node[mastr_idx + 0] += F[0];
-        F_node[mastr_idx + 1] += F[1];
 #if (NDIM == 3)
-        F_node[mastr_idx + 2] += F[2];
-#endif
-        F_node[slave_idx + 0] -= F[0];
-        F_node[slave_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[slave_idx + 2] -= F[2];
+                    R[k] = sqrt(D[0][k] * D[0][k] + D[1][k] * D[1][k] + D[2][k] * D[2][k]);
 #endif
+                }
+
+                // Evaluate the tension forces.
+                if (group.force_batch_fcn)
+                {
+                    for (int k = 0; k < batch_size; ++k)
+                    {
+                        const int num_spring_params = group.num_parameters[k_start + k];
+                        for (int j = 0; j < num_params; ++j)
+                        {
+                            params[j * FORCE_BATCH_SIZE + k] = j < num_spring_params ? parameters[k][j] : 0.0;
+                        }
+                    }
+                    group.force_batch_fcn(
+                        T, R, &params[0], FORCE_BATCH_SIZE, lag_mastr_node_idxs, lag_slave_node_idxs, batch_size);
+                }
+                else
+                {
+                    for (int k = 0; k < batch_size; ++k)
+                    {
+                        if (UNLIKELY(R[k] < std::numeric_limits<double>::epsilon())) continue;
+                        T[k] = group.force_fcn(R[k], parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]);
+                    }
+                }
+
+                // Scatter the forces.
+                for (int k = 0; k < batch_size; ++k)
+                {
+                    if (UNLIKELY(R[k] < std::numeric_limits<double>::epsilon())) continue;
+                    const int mastr_idx = petsc_mastr_node_idxs[k];
+                    const int slave_idx = petsc_slave_node_idxs[k];
+                    const double T_over_R = T[k] / R[k];
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        const double F = T_over_R * D[d][k];
+                        F_acc[mastr_idx + d] += F;
+                        F_acc[slave_idx + d] -= F;
+                    }
+                }
+            }
+        }
+
+        // Sum the forces accumulated by the other threads.
+        if (num_threads > 1) accumulateThreadForceData(F_node, num_values);
     }
 
     F_data->restoreArrays();
@@ -1107,93 +1211,67 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
-    int k, kblock, kunroll, mastr_idx, next_idx, prev_idx;
-    double K;
-    const double* D2X0;
-    double F[NDIM];
-    kblock = 0;
-    for (; kblock < (num_beams - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
-    {
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_next_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_prev_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(rigidities + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(curvatures + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
-        {
-            k = kblock * BLOCKSIZE + kunroll;
-            mastr_idx = petsc_mastr_node_idxs[k];
-            next_idx = petsc_next_node_idxs[k];
-            prev_idx = petsc_prev_node_idxs[k];
-#if !defined(NDEBUG)
-            TBOX_ASSERT(mastr_idx != next_idx);
-            TBOX_ASSERT(mastr_idx != prev_idx);
-#endif
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_next_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_prev_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_next_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_prev_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(rigidities[k + 1]);
-            PREFETCH_READ_NTA(curvatures[k + 1]);
-            K = *rigidities[k];
-            D2X0 = curvatures[k]->data();
-            F[0] = K * (X_node[next_idx + 0] + X_node[prev_idx + 0] - 2.0 * X_node[mastr_idx + 0] - D2X0[0]);
-            F[1] = K * (X_node[next_idx + 1] + X_node[prev_idx + 1] - 2.0 * X_node[mastr_idx + 1] - D2X0[1]);
-#if (NDIM == 3)
-            F[2] = K * (X_node[next_idx + 2] + X_node[prev_idx + 2] - 2.0 * X_node[mastr_idx + 2] - D2X0[2]);
-#endif
-            F_node[mastr_idx + 0] += 2.0 * F[0];
-            F_node[mastr_idx + 1] += 2.0 * F[1];
-#if (NDIM == 3)
-            F_node[mastr_idx + 2] += 2.0 * F[2];
-#endif
-            F_node[next_idx + 0] -= F[0];
-            F_node[next_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[next_idx + 2] -= F[2];
-#endif
-            F_node[prev_idx + 0] -= F[0];
-            F_node[prev_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[prev_idx + 2] -= F[2];
+    const int num_values = NDIM * static_cast<int>(F_data->getLocalNodeCount() + F_data->getGhostNodeCount());
+    const int num_threads = initializeThreadForceData(num_values);
+
+    // Beams are processed in batches.  For each batch, the bending forces are
+    // computed in structure-of-arrays form and then scattered to the nodes.
+    //
+    // When multiple threads are used, the batches are distributed among the
+    // threads, and each thread other than the first accumulates forces in its
+    // own array.  These arrays are summed once all of the batches have been
+    // processed.
+    const int num_batches = (num_beams + FORCE_BATCH_SIZE - 1) / FORCE_BATCH_SIZE;
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(num_threads)
 #endif
-        }
-    }
-    for (k = kblock * BLOCKSIZE; k < num_beams; ++k)
     {
-        mastr_idx = petsc_mastr_node_idxs[k];
-        next_idx = petsc_next_node_idxs[k];
-        prev_idx = petsc_prev_node_idxs[k];
-#if !defined(NDEBUG)
-        TBOX_ASSERT(mastr_idx != next_idx);
-        TBOX_ASSERT(mastr_idx != prev_idx);
+        double* F_acc = F_node;
+#if defined(_OPENMP)
+        const int thread_num = omp_get_thread_num();
+        if (thread_num > 0) F_acc = &d_F_thread_data[thread_num - 1][0];
 #endif
-        K = *rigidities[k];
-        D2X0 = curvatures[k]->data();
-        F[0] = K * (X_node[next_idx + 0] + X_node[prev_idx + 0] - 2.0 * X_node[mastr_idx + 0] - D2X0[0]);
-        F[1] = K * (X_node[next_idx + 1] + X_node[prev_idx + 1] - 2.0 * X_node[mastr_idx + 1] - D2X0[1]);
-#if (NDIM == 3)
-        F[2] = K * (X_node[next_idx + 2] + X_node[prev_idx + 2] - 2.0 * X_node[mastr_idx + 2] - D2X0[2]);
-#endif
-        F_node[mastr_idx + 0] += 2.0 * F[0];
-        F_node[mastr_idx + 1] += 2.0 * F[1];
-#if (NDIM == 3)
-        F_node[mastr_idx + 2] += 2.0 * F[2];
+        double F[NDIM][FORCE_BATCH_SIZE];
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
 #endif
-        F_node[next_idx + 0] -= F[0];
-        F_node[next_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[next_idx + 2] -= F[2];
-#endif
-        F_node[prev_idx + 0] -= F[0];
-        F_node[prev_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[prev_idx + 2] -= F[2];
+        for (int batch = 0; batch < num_batches; ++batch)
+        {
+            const int k_start = batch * FORCE_BATCH_SIZE;
+            const int batch_size = std::min(FORCE_BATCH_SIZE, num_beams - k_start);
+            for (int k = 0; k < batch_size; ++k)
+            {
+                const int mastr_idx = petsc_mastr_node_idxs[k_start + k];
+                const int next_idx = petsc_next_node_idxs[k_start + k];
+                const int prev_idx = petsc_prev_node_idxs[k_start + k];
+#if !defined(NDEBUG)
+                TBOX_ASSERT(mastr_idx != next_idx);
+                TBOX_ASSERT(mastr_idx != prev_idx);
 #endif
+                const double K = *rigidities[k_start + k];
+                const double* const D2X0 = curvatures[k_start + k]->data();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    F[d][k] =
+                        K * (X_node[next_idx + d] + X_node[prev_idx + d] - 2.0 * X_node[mastr_idx + d] - D2X0[d]);
+                }
+            }
+            for (int k = 0; k < batch_size; ++k)
+            {
+                const int mastr_idx = petsc_mastr_node_idxs[k_start + k];
+                const int next_idx = petsc_next_node_idxs[k_start + k];
+                const int prev_idx = petsc_prev_node_idxs[k_start + k];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    F_acc[mastr_idx + d] += 2.0 * F[d][k];
+                    F_acc[next_idx + d] -= F[d][k];
+                    F_acc[prev_idx + d] -= F[d][k];
+                }
+            }
+        }
+
+        // Sum the forces accumulated by the other threads.
+        if (num_threads > 1) accumulateThreadForceData(F_node, num_values);
     }
 
     F_data->restoreArrays();
@@ -1275,69 +1353,53 @@ IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data,
     const double* const X_node = X_data->getLocalFormVecArray()->data();
     const double* const U_node = U_data->getLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
-    int k, kblock, kunroll, idx;
-    double K, E, dX;
-    const double* X_target;
-    kblock = 0;
-    for (; kblock < (num_target_points - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
+    // Target points are processed in batches.  For each batch, the penalty
+    // forces are computed in structure-of-arrays form and then added to the
+    // nodal forces.
+    //
+    // NOTE: Each node is associated with at most one target point, so the
+    // batches may be processed concurrently without conflicts.
+    const int num_batches = (num_target_points + FORCE_BATCH_SIZE - 1) / FORCE_BATCH_SIZE;
+#if defined(_OPENMP)
+    const int num_threads = std::max(d_num_threads, 1);
+#pragma omp parallel for schedule(static) num_threads(num_threads) reduction(max : max_displacement)
+#endif
+    for (int batch = 0; batch < num_batches; ++batch)
     {
-        PREFETCH_READ_NTA_BLOCK(petsc_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(kappa + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(eta + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(X0 + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
+        const int k_start = batch * FORCE_BATCH_SIZE;
+        const int batch_size = std::min(FORCE_BATCH_SIZE, num_target_points - k_start);
+        double F[NDIM][FORCE_BATCH_SIZE], dX[NDIM][FORCE_BATCH_SIZE];
+        for (int k = 0; k < batch_size; ++k)
         {
-            k = kblock * BLOCKSIZE + kunroll;
-            idx = petsc_node_idxs[k];
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(kappa[k + 1]);
-            PREFETCH_READ_NTA(eta[k + 1]);
-            PREFETCH_READ_NTA(X0[k + 1]);
-            K = *kappa[k];
-            E = *eta[k];
-            X_target = X0[k]->data();
-            F_node[idx + 0] += K * (X_target[0] - X_node[idx + 0]) - E * U_node[idx + 0];
-            F_node[idx + 1] += K * (X_target[1] - X_node[idx + 1]) - E * U_node[idx + 1];
-#if (NDIM == 3)
-            F_node[idx + 2] += K * (X_target[2] - X_node[idx + 2]) - E * U_node[idx + 2];
-#endif
-            if (d_log_target_point_displacements)
+            const int idx = petsc_node_idxs[k_start + k];
+            const double K = *kappa[k_start + k];
+            const double E = *eta[k_start + k];
+            const double* const X_target = X0[k_start + k]->data();
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                dX = 0.0;
-                dX += (X_target[0] - X_node[idx + 0]) * (X_target[0] - X_node[idx + 0]);
-                dX += (X_target[1] - X_node[idx + 1]) * (X_target[1] - X_node[idx + 1]);
-#if (NDIM == 3)
-                dX += (X_target[2] - X_node[idx + 2]) * (X_target[2] - X_node[idx + 2]);
-#endif
-                dX = sqrt(dX);
-                max_displacement = std::max(max_displacement, dX);
+                dX[d][k] = X_target[d] - X_node[idx + d];
+                F[d][k] = K * dX[d][k] - E * U_node[idx + d];
+            }
+        }
+        for (int k = 0; k < batch_size; ++k)
+        {
+            const int idx = petsc_node_idxs[k_start + k];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                F_node[idx + d] += F[d][k];
             }
         }
-    }
-    for (k = kblock * BLOCKSIZE; k < num_target_points; ++k)
-    {
-        idx = petsc_node_idxs[k];
-        K = *kappa[k];
-        E = *eta[k];
-        X_target = X0[k]->data();
-        F_node[idx + 0] += K * (X_target[0] - X_node[idx + 0]) - E * U_node[idx + 0];
-        F_node[idx + 1] += K * (X_target[1] - X_node[idx + 1]) - E * U_node[idx + 1];
-#if (NDIM == 3)
-        F_node[idx + 2] += K * (X_target[2] - X_node[idx + 2]) - E * U_node[idx + 2];
-#endif
         if (d_log_target_point_displacements)
         {
-            dX = 0.0;
-            dX += (X_target[0] - X_node[idx + 0]) * (X_target[0] - X_node[idx + 0]);
-            dX += (X_target[1] - X_node[idx + 1]) * (X_target[1] - X_node[idx + 1]);
-#if (NDIM == 3)
-            dX += (X_target[2] - X_node[idx + 2]) * (X_target[2] - X_node[idx + 2]);
-#endif
-            dX = sqrt(dX);
-            max_displacement = std::max(max_displacement, dX);
+            for (int k = 0; k < batch_size; ++k)
+            {
+                double dX_norm_sq = 0.0;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    dX_norm_sq += dX[d][k] * dX[d][k];
+                }
+                max_displacement = std::max(max_displacement, sqrt(dX_norm_sq));
+            }
         }
     }
 
@@ -1353,6 +1415,42 @@ IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data,
     return;
 } // computeLagrangianTargetPointForce
 
+int
+IBStandardForceGen::initializeThreadForceData(const int num_values)
+{
+#if defined(_OPENMP)
+    const int num_threads = std::max(d_num_threads, 1);
+#else
+    const int num_threads = 1;
+#endif
+    d_F_thread_data.resize(num_threads - 1);
+    for (int t = 0; t < num_threads - 1; ++t)
+    {
+        d_F_thread_data[t].assign(std::max(num_values, 1), 0.0);
+    }
+    return num_threads;
+} // initializeThreadForceData
+
+void
+IBStandardForceGen::accumulateThreadForceData(double* const F_node, const int num_values)
+{
+    // NOTE: This function must be called by all of the threads in a parallel
+    // region.
+    const int num_thread_arrays = static_cast<int>(d_F_thread_data.size());
+#if defined(_OPENMP)
+#pragma omp barrier
+#pragma omp for schedule(static)
+#endif
+    for (int i = 0; i < num_values; ++i)
+    {
+        for (int t = 0; t < num_thread_arrays; ++t)
+        {
+            F_node[i] += d_F_thread_data[t][i];
+        }
+    }
+    return;
+} // accumulateThreadForceData
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
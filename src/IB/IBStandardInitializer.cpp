@@ -35,6 +35,7 @@
 #include <stddef.h>
 #include <algorithm>
 #include <cmath>
+#include <fstream>
 #include <ios>
 #include <iosfwd>
 #include <istream>
@@ -123,6 +124,59 @@ discard_comments(const std::string& input_string)
     string_stream.clear();
     return output_string;
 } // discard_comments
+
+// Identifier stored at the beginning of each binary structure file.  Because
+// the data are stored in native byte order, this value also serves to detect
+// files that were written on a machine with a different byte order.
+static const int BINARY_STRUCTURE_FILE_ID = 0x49425346;
+
+// Suffix appended to the standard file extensions for binary structure files.
+static const std::string BINARY_STRUCTURE_FILE_SUFFIX = ".bin";
+
+template <class T>
+inline bool
+read_binary_data(std::istream& is, T* const data, const size_t n)
+{
+    if (n == 0) return true;
+    is.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(n * sizeof(T)));
+    return static_cast<size_t>(is.gcount()) == n * sizeof(T);
+} // read_binary_data
+
+template <class T>
+inline bool
+read_binary_data(std::istream& is, std::vector<T>& data)
+{
+    return data.empty() || read_binary_data(is, &data[0], data.size());
+} // read_binary_data
+
+template <class T>
+inline void
+write_binary_data(std::ostream& os, const T* const data, const size_t n)
+{
+    if (n == 0) return;
+    os.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(n * sizeof(T)));
+    return;
+} // write_binary_data
+
+template <class T>
+inline void
+write_binary_data(std::ostream& os, const std::vector<T>& data)
+{
+    if (!data.empty()) write_binary_data(os, &data[0], data.size());
+    return;
+} // write_binary_data
+
+// Determine the total size in bytes of a file opened for binary input without
+// changing the current read position.
+inline std::streamoff
+get_binary_file_size(std::istream& is)
+{
+    const std::streampos pos = is.tellg();
+    is.seekg(0, std::ios::end);
+    const std::streamoff size = is.tellg();
+    is.seekg(pos);
+    return size;
+} // get_binary_file_size
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -130,6 +184,7 @@ discard_comments(const std::string& input_string)
 IBStandardInitializer::IBStandardInitializer(const std::string& object_name, Pointer<Database> input_db)
     : d_object_name(object_name),
       d_use_file_batons(true),
+      d_use_binary_structure_files(false),
       d_max_levels(-1),
       d_level_is_initialized(),
       d_silo_writer(NULL),
@@ -652,6 +707,136 @@ IBStandardInitializer::tagCellsForInitialRefinement(const Pointer<PatchHierarchy
     return;
 } // tagCellsForInitialRefinement
 
+void
+IBStandardInitializer::convertStructureFilesToBinary(const std::string& base_filename)
+{
+    std::string line_string;
+
+    // Convert the vertex file.
+    const std::string vertex_filename = base_filename + ".vertex";
+    std::ifstream vertex_stream(vertex_filename.c_str(), std::ios::in);
+    if (!vertex_stream.is_open())
+    {
+        TBOX_ERROR("IBStandardInitializer::convertStructureFilesToBinary():\n"
+                   << "  Cannot find required vertex file: "
+                   << vertex_filename
+                   << std::endl);
+    }
+    int num_vertex = -1;
+    if (std::getline(vertex_stream, line_string))
+    {
+        std::istringstream line_stream(discard_comments(line_string));
+        line_stream >> num_vertex;
+    }
+    if (num_vertex <= 0)
+    {
+        TBOX_ERROR("IBStandardInitializer::convertStructureFilesToBinary():\n"
+                   << "  Invalid entry in input file encountered on line 1 of file "
+                   << vertex_filename
+                   << std::endl);
+    }
+    std::vector<double> X_data(NDIM * num_vertex);
+    for (int k = 0; k < num_vertex; ++k)
+    {
+        bool valid_entry = static_cast<bool>(std::getline(vertex_stream, line_string));
+        std::istringstream line_stream(discard_comments(line_string));
+        for (unsigned int d = 0; valid_entry && d < NDIM; ++d)
+        {
+            valid_entry = static_cast<bool>(line_stream >> X_data[NDIM * k + d]);
+        }
+        if (!valid_entry)
+        {
+            TBOX_ERROR("IBStandardInitializer::convertStructureFilesToBinary():\n"
+                       << "  Invalid entry in input file encountered on line "
+                       << k + 2
+                       << " of file "
+                       << vertex_filename
+                       << std::endl);
+        }
+    }
+    vertex_stream.close();
+    const std::string vertex_bin_filename = vertex_filename + BINARY_STRUCTURE_FILE_SUFFIX;
+    std::ofstream vertex_bin_stream(vertex_bin_filename.c_str(), std::ios::out | std::ios::binary);
+    const int vertex_header[3] = { BINARY_STRUCTURE_FILE_ID, NDIM, num_vertex };
+    write_binary_data(vertex_bin_stream, vertex_header, 3);
+    write_binary_data(vertex_bin_stream, X_data);
+    if (!vertex_bin_stream.good())
+    {
+        TBOX_ERROR("IBStandardInitializer::convertStructureFilesToBinary():\n"
+                   << "  Unable to write binary file "
+                   << vertex_bin_filename
+                   << std::endl);
+    }
+    vertex_bin_stream.close();
+
+    // Convert the spring file, if any.
+    const std::string spring_filename = base_filename + ".spring";
+    std::ifstream spring_stream(spring_filename.c_str(), std::ios::in);
+    if (!spring_stream.is_open()) return;
+    int num_edges = -1;
+    if (std::getline(spring_stream, line_string))
+    {
+        std::istringstream line_stream(discard_comments(line_string));
+        line_stream >> num_edges;
+    }
+    if (num_edges < 0)
+    {
+        TBOX_ERROR("IBStandardInitializer::convertStructureFilesToBinary():\n"
+                   << "  Invalid entry in input file encountered on line 1 of file "
+                   << spring_filename
+                   << std::endl);
+    }
+    std::vector<int> spring_idxs(4 * num_edges);
+    std::vector<double> spring_params;
+    spring_params.reserve(2 * num_edges);
+    for (int k = 0; k < num_edges; ++k)
+    {
+        bool valid_entry = static_cast<bool>(std::getline(spring_stream, line_string));
+        std::istringstream line_stream(discard_comments(line_string));
+        double kappa, rest_length;
+        valid_entry = valid_entry && (line_stream >> spring_idxs[4 * k]) && (line_stream >> spring_idxs[4 * k + 1]) &&
+                      (line_stream >> kappa) && (line_stream >> rest_length);
+        if (!valid_entry)
+        {
+            TBOX_ERROR("IBStandardInitializer::convertStructureFilesToBinary():\n"
+                       << "  Invalid entry in input file encountered on line "
+                       << k + 2
+                       << " of file "
+                       << spring_filename
+                       << std::endl);
+        }
+        spring_params.push_back(kappa);
+        spring_params.push_back(rest_length);
+        int force_fcn_idx = 0;
+        if (!(line_stream >> force_fcn_idx)) force_fcn_idx = 0;
+        int num_parameters = 2;
+        double param;
+        while (line_stream >> param)
+        {
+            spring_params.push_back(param);
+            ++num_parameters;
+        }
+        spring_idxs[4 * k + 2] = force_fcn_idx;
+        spring_idxs[4 * k + 3] = num_parameters;
+    }
+    spring_stream.close();
+    const std::string spring_bin_filename = spring_filename + BINARY_STRUCTURE_FILE_SUFFIX;
+    std::ofstream spring_bin_stream(spring_bin_filename.c_str(), std::ios::out | std::ios::binary);
+    const int spring_header[3] = { BINARY_STRUCTURE_FILE_ID, num_edges, static_cast<int>(spring_params.size()) };
+    write_binary_data(spring_bin_stream, spring_header, 3);
+    write_binary_data(spring_bin_stream, spring_idxs);
+    write_binary_data(spring_bin_stream, spring_params);
+    if (!spring_bin_stream.good())
+    {
+        TBOX_ERROR("IBStandardInitializer::convertStructureFilesToBinary():\n"
+                   << "  Unable to write binary file "
+                   << spring_bin_filename
+                   << std::endl);
+    }
+    spring_bin_stream.close();
+    return;
+} // convertStructureFilesToBinary
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -754,10 +939,69 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
             }
 
             // Ensure that the file exists.
-            const std::string vertex_filename = d_base_filename[ln][j] + extension;
+            const std::string vertex_filename =
+                d_base_filename[ln][j] + extension + (d_use_binary_structure_files ? BINARY_STRUCTURE_FILE_SUFFIX : "");
             std::ifstream file_stream;
-            file_stream.open(vertex_filename.c_str(), std::ios::in);
-            if (file_stream.is_open())
+            file_stream.open(vertex_filename.c_str(),
+                             d_use_binary_structure_files ? std::ios::in | std::ios::binary : std::ios::in);
+            if (file_stream.is_open() && d_use_binary_structure_files)
+            {
+                plog << d_object_name << ":  "
+                     << "processing vertex data from binary input file named " << vertex_filename << std::endl
+                     << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+
+                // The header contains the file identifier, the spatial
+                // dimension, and the number of vertices.  It is followed by the
+                // coordinates of the vertices.
+                //
+                // The size of the file is checked against the header before
+                // any storage is allocated.
+                const std::streamoff file_size = get_binary_file_size(file_stream);
+                int header[3];
+                if (!read_binary_data(file_stream, header, 3) || header[0] != BINARY_STRUCTURE_FILE_ID ||
+                    header[1] != NDIM || header[2] <= 0)
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Invalid header in binary input file " << vertex_filename
+                                             << std::endl);
+                }
+                const std::streamoff expected_file_size =
+                    static_cast<std::streamoff>(3 * sizeof(int)) +
+                    static_cast<std::streamoff>(header[2]) * static_cast<std::streamoff>(NDIM * sizeof(double));
+                if (file_size != expected_file_size)
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Binary input file " << vertex_filename << " contains "
+                                             << file_size
+                                             << " bytes, but its header requires "
+                                             << expected_file_size
+                                             << " bytes"
+                                             << std::endl);
+                }
+                d_num_vertex[ln][j] = header[2];
+                std::vector<double> X_data(NDIM * d_num_vertex[ln][j]);
+                if (!read_binary_data(file_stream, X_data))
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file " << vertex_filename
+                                             << std::endl);
+                }
+                d_vertex_posn[ln][j].resize(d_num_vertex[ln][j]);
+                for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                {
+                    Point& X = d_vertex_posn[ln][j][k];
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X[d] = d_length_scale_factor * (X_data[NDIM * k + d] + d_posn_shift[d]);
+                    }
+                }
+
+                // Close the input file.
+                file_stream.close();
+
+                plog << d_object_name << ":  "
+                     << "read " << d_num_vertex[ln][j] << " vertices from binary input file named " << vertex_filename
+                     << std::endl
+                     << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+            }
+            else if (file_stream.is_open())
             {
                 plog << d_object_name << ":  "
                      << "processing vertex data from ASCII input file named " << vertex_filename << std::endl
@@ -874,19 +1118,67 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
             if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
             // Ensure that the file exists.
-            const std::string spring_filename = d_base_filename[ln][j] + extension;
+            const std::string spring_filename =
+                d_base_filename[ln][j] + extension + (d_use_binary_structure_files ? BINARY_STRUCTURE_FILE_SUFFIX : "");
+            const std::string file_format = d_use_binary_structure_files ? "binary" : "ASCII";
             std::ifstream file_stream;
-            file_stream.open(spring_filename.c_str(), std::ios::in);
+            file_stream.open(spring_filename.c_str(),
+                             d_use_binary_structure_files ? std::ios::in | std::ios::binary : std::ios::in);
             if (file_stream.is_open())
             {
                 plog << d_object_name << ":  "
-                     << "processing spring data from ASCII input file named " << spring_filename << std::endl
+                     << "processing spring data from " << file_format << " input file named " << spring_filename
+                     << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of edges in the input
                 // file.
+                //
+                // The header of a binary file contains the file identifier, the
+                // number of edges, and the total number of spring parameters.
+                // It is followed by the vertex indices, force function index,
+                // and number of parameters of each spring, and then by the
+                // parameters of all of the springs.
                 int num_edges = -1;
-                if (!std::getline(file_stream, line_string))
+                std::vector<int> binary_spring_idxs;
+                std::vector<double> binary_spring_params;
+                if (d_use_binary_structure_files)
+                {
+                    //
+                    // The counts in the header are checked against the size
+                    // of the file before any storage is allocated.
+                    const std::streamoff file_size = get_binary_file_size(file_stream);
+                    int header[3];
+                    if (!read_binary_data(file_stream, header, 3) || header[0] != BINARY_STRUCTURE_FILE_ID ||
+                        header[1] < 0 || header[2] < 0)
+                    {
+                        TBOX_ERROR(d_object_name << ":\n  Invalid header in binary input file " << spring_filename
+                                                 << std::endl);
+                    }
+                    const std::streamoff expected_file_size =
+                        static_cast<std::streamoff>(3 * sizeof(int)) +
+                        static_cast<std::streamoff>(header[1]) * static_cast<std::streamoff>(4 * sizeof(int)) +
+                        static_cast<std::streamoff>(header[2]) * static_cast<std::streamoff>(sizeof(double));
+                    if (file_size != expected_file_size)
+                    {
+                        TBOX_ERROR(d_object_name << ":\n  Binary input file " << spring_filename << " contains "
+                                                 << file_size
+                                                 << " bytes, but its header requires "
+                                                 << expected_file_size
+                                                 << " bytes"
+                                                 << std::endl);
+                    }
+                    num_edges = header[1];
+                    binary_spring_idxs.resize(4 * num_edges);
+                    binary_spring_params.resize(header[2]);
+                    if (!read_binary_data(file_stream, binary_spring_idxs) ||
+                        !read_binary_data(file_stream, binary_spring_params))
+                    {
+                        TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file " << spring_filename
+                                                 << std::endl);
+                    }
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file "
@@ -906,7 +1198,7 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                     }
                 }
 
-                if (num_edges <= 0)
+                if (num_edges < 0)
                 {
                     TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line 1 of file "
                                              << spring_filename
@@ -915,12 +1207,51 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
 
                 // Each successive line provides the connectivity and material parameter
                 // information for each spring in the structure.
+                int binary_param_offset = 0;
                 for (int k = 0; k < num_edges; ++k)
                 {
                     Edge e;
                     std::vector<double> parameters(2);
                     int force_fcn_idx = 0;
-                    if (!std::getline(file_stream, line_string))
+                    if (d_use_binary_structure_files)
+                    {
+                        e.first = binary_spring_idxs[4 * k];
+                        e.second = binary_spring_idxs[4 * k + 1];
+                        force_fcn_idx = binary_spring_idxs[4 * k + 2];
+                        const int num_parameters = binary_spring_idxs[4 * k + 3];
+                        if (num_parameters < 2 ||
+                            binary_param_offset + num_parameters > static_cast<int>(binary_spring_params.size()))
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Invalid entry for spring " << k
+                                                     << " in binary input file "
+                                                     << spring_filename
+                                                     << std::endl);
+                        }
+                        parameters.assign(binary_spring_params.begin() + binary_param_offset,
+                                          binary_spring_params.begin() + binary_param_offset + num_parameters);
+                        binary_param_offset += num_parameters;
+                        if ((e.first < min_idx) || (e.first >= max_idx) || (e.second < min_idx) ||
+                            (e.second >= max_idx))
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Invalid entry for spring " << k
+                                                     << " in binary input file "
+                                                     << spring_filename
+                                                     << std::endl
+                                                     << "  vertex index is out of range"
+                                                     << std::endl);
+                        }
+                        if (parameters[0] < 0.0 || parameters[1] < 0.0)
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Invalid entry for spring " << k
+                                                     << " in binary input file "
+                                                     << spring_filename
+                                                     << std::endl
+                                                     << "  spring constant or resting length is negative"
+                                                     << std::endl);
+                        }
+                        parameters[1] *= d_length_scale_factor;
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << k + 2
                                                  << " of file "
@@ -1037,7 +1368,9 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                         (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
                     {
                         TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
-                                                      "encountered in ASCII input file named "
+                                                      "encountered in "
+                                                   << file_format
+                                                   << " input file named "
                                                    << spring_filename
                                                    << "."
                                                    << std::endl);
@@ -1067,11 +1400,24 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                     d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
                 }
 
+                // All of the spring parameters in a binary file must be used.
+                if (d_use_binary_structure_files &&
+                    binary_param_offset != static_cast<int>(binary_spring_params.size()))
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Binary input file " << spring_filename << " contains "
+                                             << binary_spring_params.size()
+                                             << " spring parameters, but its springs use "
+                                             << binary_param_offset
+                                             << " parameters"
+                                             << std::endl);
+                }
+
                 // Close the input file.
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_edges << " edges from ASCII input file named " << spring_filename << std::endl
+                     << "read " << num_edges << " edges from " << file_format << " input file named "
+                     << spring_filename << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
 
@@ -3405,6 +3751,10 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     // reading the same file at once.
     if (db->keyExists("use_file_batons")) d_use_file_batons = db->getBool("use_file_batons");
 
+    // Determine whether to read the vertex and spring data from binary files.
+    if (db->keyExists("use_binary_structure_files"))
+        d_use_binary_structure_files = db->getBool("use_binary_structure_files");
+
     // Determine the (maximum) number of levels in the locally refined grid.
     // Note that each piece of the Lagrangian structure must be assigned to a
     // particular level of the grid.
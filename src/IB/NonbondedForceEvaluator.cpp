@@ -32,6 +32,10 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "ibamr/NonbondedForceEvaluator.h"
 #include "ibamr/namespaces.h"
 #include "ibtk/LNodeSetData.h"
@@ -46,6 +50,12 @@ namespace IBAMR
 
 NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
                                                  Pointer<CartesianGridGeometry<NDIM> > grid_geometry)
+    : d_use_verlet_lists(false),
+      d_verlet_skin(0.0),
+      d_pair_idxs(),
+      d_pair_offsets(),
+      d_X_ref(),
+      d_pair_list_is_valid()
 {
     // get interaction radius
     if (input_db->keyExists("interaction_radius"))
@@ -67,6 +77,23 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
         TBOX_ERROR("Must specify regrid_alpha for NonbondedForceEvaluator.");
     }
 
+    // get Verlet list settings
+    if (input_db->keyExists("use_verlet_lists"))
+    {
+        d_use_verlet_lists = input_db->getBool("use_verlet_lists");
+    }
+    if (d_use_verlet_lists)
+    {
+        if (input_db->keyExists("verlet_skin"))
+        {
+            d_verlet_skin = input_db->getDouble("verlet_skin");
+        }
+        else
+        {
+            TBOX_ERROR("Must specify verlet_skin for NonbondedForceEvaluator when use_verlet_lists = TRUE.");
+        }
+    }
+
     // get grid geometry and grid bounds
     d_grid_geometry = grid_geometry;
 
@@ -99,40 +126,36 @@ NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
     //          F_data - pointer to LData object containing forces on particles.  Will
     //                   be added to by this function.
     //
+    //   NOTE: computeLagrangianForce() does not call this function; it obtains the
+    //   data arrays once and evaluates all pairs directly.
+    //
     //////////////////////////////////////////////////////////////////////////////////
 
-    // get vectors of data
-    // How costly is this?  TODO: Check, maybe just do this once in the loop.
     PetscScalar* position;
     VecGetArray(X_data->getVec(), &position);
     PetscScalar* force;
     VecGetArray(F_data->getVec(), &force);
+    accumulatePairForce(mstr_petsc_idx, search_petsc_idx, &cell_offset[0], position, force);
+    VecRestoreArray(F_data->getVec(), &force);
+    VecRestoreArray(X_data->getVec(), &position);
+    return;
+} // evaluateForces
 
-    // get domain bounds
-    const double* x_lower = d_grid_geometry->getXLower();
-    const double* x_upper = d_grid_geometry->getXUpper();
-
-    double R = 0.0; // distance between particles
-    double D[NDIM]; // vector connecting particles.
-
-    for (int k = 0; k < NDIM; ++k)
-    {
-        D[k] = (position[mstr_petsc_idx * NDIM + k] - position[search_petsc_idx * NDIM + k] -
-                cell_offset[k] * (x_upper[k] - x_lower[k]));
-        R += pow(D[k], 2);
-    }
-    R = sqrt(R);
-
-    double nonbdd_force[NDIM];
-    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
-    for (int k = 0; k < NDIM; ++k)
+void
+NonbondedForceEvaluator::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                             const int level_number,
+                                             const double /*init_data_time*/,
+                                             const bool /*initial_time*/,
+                                             LDataManager* const /*l_data_manager*/)
+{
+    // The nodes may have been redistributed, so any cached pair list is no
+    // longer valid.
+    if (level_number < static_cast<int>(d_pair_list_is_valid.size()))
     {
-        force[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
-        force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
+        d_pair_list_is_valid[level_number] = false;
     }
-    VecRestoreArray(F_data->getVec(), &force);
     return;
-} // evaluateForces
+} // initializeLevelData
 
 void
 NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
@@ -147,24 +170,105 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     if (!grid_geom->getDomainIsSingleBox()) TBOX_ERROR("physical domain must be a single box...\n");
 
-    // These will only work if the domain is a single box.
-    assert(grid_geom->getDomainIsSingleBox());
-    const double* const x_lower = grid_geom->getXLower();
-    const double* const x_upper = grid_geom->getXUpper();
-    const double* const domain_dx = grid_geom->getDx();
+    // Resize the vectors corresponding to data individually maintained for
+    // separate levels of the patch hierarchy.
+    const int new_size = std::max(level_number + 1, static_cast<int>(d_pair_list_is_valid.size()));
+    d_pair_idxs.resize(new_size);
+    d_pair_offsets.resize(new_size);
+    d_X_ref.resize(new_size);
+    d_pair_list_is_valid.resize(new_size, false);
+    std::vector<int>& pair_idxs = d_pair_idxs[level_number];
+    std::vector<int>& pair_offsets = d_pair_offsets[level_number];
+    std::vector<double>& X_ref = d_X_ref[level_number];
 
-    // Maximum index in our domain.
-    std::vector<int> max_cell_idx(NDIM);
-    for (int k = 0; k < NDIM; ++k)
+    // Get the data arrays once for all of the pair interactions.
+    double* const F_node = F_data->getGhostedLocalFormVecArray()->data();
+    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+    const int num_values = NDIM * static_cast<int>(X_data->getLocalNodeCount() + X_data->getGhostNodeCount());
+
+    // Determine whether the pair list needs to be rebuilt.  Verlet lists
+    // remain valid until some node has moved more than half of the skin
+    // distance since the list was built.
+    bool rebuild_pair_list =
+        !d_use_verlet_lists || !d_pair_list_is_valid[level_number] || static_cast<int>(X_ref.size()) != num_values;
+    if (!rebuild_pair_list)
+    {
+        const double max_displacement_sq = 0.25 * d_verlet_skin * d_verlet_skin;
+        for (int i = 0; i < num_values && !rebuild_pair_list; i += NDIM)
+        {
+            double displacement_sq = 0.0;
+            for (unsigned int k = 0; k < NDIM; ++k)
+            {
+                displacement_sq += (X_node[i + k] - X_ref[i + k]) * (X_node[i + k] - X_ref[i + k]);
+            }
+            rebuild_pair_list = displacement_sq > max_displacement_sq;
+        }
+    }
+    if (rebuild_pair_list)
+    {
+        const double list_radius = d_use_verlet_lists ? d_interaction_radius + d_verlet_skin : 0.0;
+        buildPairList(hierarchy, level_number, l_data_manager, X_node, list_radius, pair_idxs, pair_offsets);
+        if (d_use_verlet_lists)
+        {
+            X_ref.assign(X_node, X_node + num_values);
+            d_pair_list_is_valid[level_number] = true;
+        }
+    }
+
+    // Accumulate the forces.
+    const int num_pairs = static_cast<int>(pair_idxs.size()) / 2;
+    for (int k = 0; k < num_pairs; ++k)
     {
-        max_cell_idx[k] = int((x_upper[k] - x_lower[k]) / domain_dx[k]);
+        accumulatePairForce(pair_idxs[2 * k], pair_idxs[2 * k + 1], &pair_offsets[NDIM * k], X_node, F_node);
     }
+    F_data->restoreArrays();
+    X_data->restoreArrays();
+    return;
+} // computeLagrangianForce
 
-    // we will grow the search box by interaction_radius + 2.0*regrid_alpha
-    IntVector<NDIM> grow_amount(int(ceil(d_interaction_radius + 2.0 * d_regrid_alpha)));
+void
+NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
+{
+    // set the nonbonded force function pointer to the given force function pointer
+    d_force_fcn_ptr = force_fcn_ptr;
+    return;
+} // registerForceFcnPtr
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+NonbondedForceEvaluator::buildPairList(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                       const int level_number,
+                                       LDataManager* const l_data_manager,
+                                       const double* const X_node,
+                                       const double list_radius,
+                                       std::vector<int>& pair_idxs,
+                                       std::vector<int>& pair_offsets) const
+{
+    //   Function to determine the pairs of nodes that interact on the specified
+    //   level of the patch hierarchy.
+    //
+    //   The nodes in the master cell interact with the nodes in all cells up to
+    //   interaction_radius/dx + 2.0*regrid_alpha cells away in each direction.
+    //   Each pair is assigned to the patch containing the node with the smaller
+    //   Lagrangian index (the master node), so that each pair is evaluated
+    //   exactly once.  Pairs are found by looping over a half-shell of cell
+    //   offsets, so that each pair of cells is visited only once.
+    //
+    //   If list_radius is positive, only pairs that are separated by no more than
+    //   list_radius are stored.
+    //
+    //////////////////////////////////////////////////////////////////////////////////
+
+    pair_idxs.clear();
+    pair_offsets.clear();
+
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const double* const x_lower = grid_geom->getXLower();
+    const double* const x_upper = grid_geom->getXUpper();
+    const double list_radius_sq = list_radius * list_radius;
     const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
 
-    // iterate through levels.
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
@@ -174,77 +278,139 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
         const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
         const double* const patch_dx = patch_geom->getDx();
 
-        std::vector<int> cell_offset(NDIM);
-        // Loop through cells in this processors patch. For each iteration, this
-        // is the "master" cell. Iterate through particles in the box, and add
-        // springs.
-        for (LNodeSetData::CellIterator cit(patch_box); cit; cit++)
+        // We will grow the search box by enough cells in each direction to find
+        // all pairs within interaction_radius (or list_radius, if it is
+        // larger), plus 2.0*regrid_alpha cells to account for the motion of the
+        // nodes since they were last assigned to cells.
+        const double search_radius = std::max(d_interaction_radius, list_radius);
+        IntVector<NDIM> grow_amount;
+        for (unsigned int k = 0; k < NDIM; ++k)
+        {
+            grow_amount(k) = int(ceil(search_radius / patch_dx[k] + 2.0 * d_regrid_alpha));
+        }
+        const Box<NDIM> search_box = Box<NDIM>::grow(patch_box, grow_amount) * current_idx_data->getGhostBox();
+
+        // Half-shell stencil of cell offsets.  The zero offset comes first and
+        // is treated specially, since pairs within a single cell must only be
+        // visited once.
+        std::vector<IntVector<NDIM> > half_shell(1, IntVector<NDIM>(0));
+        for (Box<NDIM>::Iterator b(Box<NDIM>(-grow_amount, grow_amount)); b; b++)
+        {
+            const IntVector<NDIM> offset = b();
+            for (int k = NDIM - 1; k >= 0; --k)
+            {
+                if (offset(k) == 0) continue;
+                if (offset(k) > 0) half_shell.push_back(offset);
+                break;
+            }
+        }
+
+        // Build a flat cell-linked list of the nodes in the search box.
+        std::vector<int> cell_head(search_box.size(), -1);
+        std::vector<int> node_next, node_lag_idx, node_petsc_idx;
+        for (Box<NDIM>::Iterator b(search_box); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            LNodeSet* const node_set = current_idx_data->getItem(i);
+            if (!node_set) continue;
+            const int cell = search_box.offset(i);
+            for (LNodeSet::iterator it = node_set->begin(); it != node_set->end(); ++it)
+            {
+                LNodeSet::value_type& node_idx = *it;
+                node_next.push_back(cell_head[cell]);
+                node_lag_idx.push_back(node_idx->getLagrangianIndex());
+                node_petsc_idx.push_back(node_idx->getLocalPETScIndex());
+                cell_head[cell] = static_cast<int>(node_next.size()) - 1;
+            }
+        }
+
+        // Loop over pairs of cells, collecting the interacting pairs of nodes.
+        int cell_offset[NDIM];
+        for (Box<NDIM>::Iterator b(search_box); b; b++)
         {
-            // get list of particles in this cell
-            const Index<NDIM>& first_cell_idx = *cit;
-            LNodeSet* const mstr_node_set = current_idx_data->getItem(first_cell_idx);
-            if (mstr_node_set)
+            const Index<NDIM>& i = b();
+            const int cell = search_box.offset(i);
+            if (cell_head[cell] == -1) continue;
+            const bool i_in_patch = patch_box.contains(i);
+            for (unsigned int s = 0; s < half_shell.size(); ++s)
             {
-                Box<NDIM> search_box(first_cell_idx, first_cell_idx);
-                // loop over neighboring cells, up to interaction_radius +
-                // 2*regrid_alpha away.
-                for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(search_box, grow_amount)); scit; scit++)
+                const Index<NDIM> j = i + half_shell[s];
+                if (!search_box.contains(j)) continue;
+                const bool j_in_patch = patch_box.contains(j);
+                if (!i_in_patch && !j_in_patch) continue;
+                const int search_cell = search_box.offset(j);
+                if (cell_head[search_cell] == -1) continue;
+                for (int a = cell_head[cell]; a != -1; a = node_next[a])
                 {
-                    // loop over particles in the neighbor cell, adding up
-                    // forces onto the particle in the "master" cell At this
-                    // point we know both cells, need to figure out periodic
-                    // additions.
-                    const Index<NDIM>& search_cell_idx = *scit;
-
-                    // search across periodic boundaries.
-                    for (int k = 0; k < NDIM; ++k)
-                    {
-                        // Difference between lower boundary and this search cell.
-                        double absolute_diff = search_cell_idx[k] * patch_dx[k];
-                        // Periodic offset of this cell.
-                        cell_offset[k] = floor(absolute_diff / (x_upper[k] - x_lower[k]));
-                    }
-                    LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
-                    if (search_node_set)
+                    for (int c = (s == 0 ? node_next[a] : cell_head[search_cell]); c != -1; c = node_next[c])
                     {
-                        // we have a set of nodes in the first cell and the search cell,
-                        // add up forces
-                        // and accumulate for the first cell.
-                        for (LNodeSet::iterator it = mstr_node_set->begin(); it != mstr_node_set->end(); ++it)
+                        if (node_lag_idx[a] == node_lag_idx[c]) continue;
+
+                        // The master node must be located in this patch.
+                        const bool a_is_mstr = node_lag_idx[a] < node_lag_idx[c];
+                        if (a_is_mstr ? !i_in_patch : !j_in_patch) continue;
+                        const int mstr_petsc_idx = node_petsc_idx[a_is_mstr ? a : c];
+                        const int search_petsc_idx = node_petsc_idx[a_is_mstr ? c : a];
+                        const Index<NDIM>& search_cell_idx = a_is_mstr ? j : i;
+
+                        // Periodic offset of the search cell.
+                        for (unsigned int k = 0; k < NDIM; ++k)
                         {
-                            // master nodes
-                            LNodeSet::value_type& mstr_node_idx = *it;
-                            const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
-                            const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
+                            const double absolute_diff = search_cell_idx(k) * patch_dx[k];
+                            cell_offset[k] = int(floor(absolute_diff / (x_upper[k] - x_lower[k])));
+                        }
 
-                            for (LNodeSet::iterator sit = search_node_set->begin(); sit != search_node_set->end();
-                                 ++sit)
+                        if (list_radius > 0.0)
+                        {
+                            double R_sq = 0.0;
+                            for (unsigned int k = 0; k < NDIM; ++k)
                             {
-                                LNodeSet::value_type& search_node_idx = *sit;
-                                const int search_lag_idx = search_node_idx->getLagrangianIndex();
-                                const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
-                                if (mstr_lag_idx < search_lag_idx)
-                                {
-                                    // apply forces with the force evaluator
-                                    evaluateForces(mstr_petsc_idx, search_petsc_idx, X_data, cell_offset, F_data);
-                                }
-                            } // search node index
-                        }     // mstr node index
-                    }         // if(search node set)
-                }             // search cell loop
-            }                 // if mastr_node_idx
-        }                     // first cell
-    }                         // patches
+                                const double D = X_node[mstr_petsc_idx * NDIM + k] -
+                                                 X_node[search_petsc_idx * NDIM + k] -
+                                                 cell_offset[k] * (x_upper[k] - x_lower[k]);
+                                R_sq += D * D;
+                            }
+                            if (R_sq > list_radius_sq) continue;
+                        }
+
+                        pair_idxs.push_back(mstr_petsc_idx);
+                        pair_idxs.push_back(search_petsc_idx);
+                        pair_offsets.insert(pair_offsets.end(), cell_offset, cell_offset + NDIM);
+                    } // search node
+                }     // master node
+            }         // half-shell offset
+        }             // cell
+    }                 // patches
     return;
-} // computeLagrangianForce
+} // buildPairList
 
 void
-NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
+NonbondedForceEvaluator::accumulatePairForce(const int mstr_petsc_idx,
+                                             const int search_petsc_idx,
+                                             const int* const cell_offset,
+                                             const double* const X_node,
+                                             double* const F_node) const
 {
-    // set the nonbonded force function pointer to the given force function pointer
-    d_force_fcn_ptr = force_fcn_ptr;
+    // get domain bounds
+    const double* x_lower = d_grid_geometry->getXLower();
+    const double* x_upper = d_grid_geometry->getXUpper();
+
+    double D[NDIM]; // vector connecting particles.
+    for (int k = 0; k < NDIM; ++k)
+    {
+        D[k] = (X_node[mstr_petsc_idx * NDIM + k] - X_node[search_petsc_idx * NDIM + k] -
+                cell_offset[k] * (x_upper[k] - x_lower[k]));
+    }
+
+    double nonbdd_force[NDIM];
+    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
+    for (int k = 0; k < NDIM; ++k)
+    {
+        F_node[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
+        F_node[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
+    }
     return;
-} // registerForceFcnPtr
+} // accumulatePairForce
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -494,10 +494,12 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
     const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
 
-    // Indicate that all solvers need to be reinitialized if the current
-    // timestep size is different from the previous one.
+    // Indicate that all solvers need to be reinitialized at the initial time.
+    // When the current timestep size is different from the previous one, only
+    // the values of the operator coefficients change, and the solvers are first
+    // given the opportunity to update their coefficients in place.
     const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
-    if (dt_change)
+    if (initial_time)
     {
         std::fill(d_helmholtz_solvers_need_init.begin(), d_helmholtz_solvers_need_init.end(), true);
         std::fill(d_helmholtz_rhs_ops_need_init.begin(), d_helmholtz_rhs_ops_need_init.end(), true);
@@ -631,11 +633,23 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
 
         // Initialize the linear solver.
         Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
-        helmholtz_solver->setPoissonSpecifications(solver_spec);
         helmholtz_solver->setPhysicalBcCoefs(Q_bc_coef);
         helmholtz_solver->setHomogeneousBc(false);
         helmholtz_solver->setSolutionTime(new_time);
         helmholtz_solver->setTimeInterval(current_time, new_time);
+        if (dt_change && !d_helmholtz_solvers_need_init[l])
+        {
+            if (d_enable_logging)
+            {
+                plog << d_object_name << ": "
+                     << "Updating Helmholtz solver coefficients for variable number " << l << "\n";
+            }
+            d_helmholtz_solvers_need_init[l] = !helmholtz_solver->updatePoissonSpecifications(solver_spec);
+        }
+        else
+        {
+            helmholtz_solver->setPoissonSpecifications(solver_spec);
+        }
         if (d_helmholtz_solvers_need_init[l])
         {
             if (d_enable_logging)
@@ -83,22 +83,6 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
-namespace
-{
-void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
-{
-    for (int depth = 0; depth < data.getDepth(); ++depth)
-    {
-        for (Box<NDIM>::Iterator i(box); i; i++)
-        {
-            RNG::genrandn(&data(i(), depth));
-        }
-    }
-    return;
-} // genrandn
-}
-
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 AdvDiffStochasticForcing::AdvDiffStochasticForcing(const std::string& object_name,
@@ -271,8 +255,14 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         }
 
         // Generate random components.
+        //
+        // The values are generated by a counter-based generator, so that the
+        // value associated with each side does not depend on the patch
+        // decomposition.  Each random component and each side axis uses a
+        // distinct stream.
         if (cycle_num == 0)
         {
+            const int step_num = d_adv_diff_solver->getIntegratorStep();
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -284,7 +274,11 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                         Pointer<SideData<NDIM, double> > F_sc_data = patch->getPatchData(d_F_sc_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(F_sc_data->getArrayData(d), SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d));
+                            RNG::genrandn(F_sc_data->getArrayData(d),
+                                          SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d),
+                                          step_num,
+                                          level_num,
+                                          NDIM * k + d);
                         }
                     }
                 }
@@ -2309,9 +2309,10 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
     P_problem_coefs.setDConstant(rho == 0.0 ? -1.0 : -1.0 / rho);
 
     // Ensure that solver components are appropriately reinitialized when the
-    // time step size changes.
+    // time step size changes.  Solvers that are already initialized are first
+    // given the opportunity to update their coefficients in place.
     const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
-    if (dt_change)
+    if (initial_time)
     {
         d_velocity_solver_needs_init = true;
         d_stokes_solver_needs_init = true;
@@ -2447,10 +2448,21 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
     // Setup subdomain solvers.
     if (d_velocity_solver)
     {
-        d_velocity_solver->setPoissonSpecifications(U_problem_coefs);
         d_velocity_solver->setPhysicalBcCoefs(d_U_star_bc_coefs);
         d_velocity_solver->setSolutionTime(new_time);
         d_velocity_solver->setTimeInterval(current_time, new_time);
+        if (dt_change && !d_velocity_solver_needs_init)
+        {
+            if (d_enable_logging)
+                plog << d_object_name << "::preprocessIntegrateHierarchy(): updating "
+                                         "velocity subdomain solver coefficients"
+                     << std::endl;
+            d_velocity_solver_needs_init = !d_velocity_solver->updatePoissonSpecifications(U_problem_coefs);
+        }
+        else
+        {
+            d_velocity_solver->setPoissonSpecifications(U_problem_coefs);
+        }
         if (d_velocity_solver_needs_init)
         {
             if (d_enable_logging)
@@ -2538,6 +2550,14 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
             TBOX_WARNING("No special BCs set for the preconditioner \n");
         }
     }
+    if (dt_change && !d_stokes_solver_needs_init)
+    {
+        if (d_enable_logging)
+            plog << d_object_name << "::preprocessIntegrateHierarchy(): updating "
+                                     "incompressible Stokes solver coefficients"
+                 << std::endl;
+        d_stokes_solver_needs_init = !d_stokes_solver->updateVelocityPoissonSpecifications(U_problem_coefs);
+    }
     if (d_stokes_solver_needs_init)
     {
         if (d_enable_logging)
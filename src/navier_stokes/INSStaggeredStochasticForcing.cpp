@@ -163,19 +163,6 @@ compute_tangential_extension(const Box<NDIM>& box, const int data_axis)
     extended_box.upper()(data_axis) += 1;
     return extended_box;
 } // compute_tangential_extension
-
-void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
-{
-    for (int depth = 0; depth < data.getDepth(); ++depth)
-    {
-        for (Box<NDIM>::Iterator i(box); i; i++)
-        {
-            RNG::genrandn(&data(i(), depth));
-        }
-    }
-    return;
-} // genrandn
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -303,10 +290,17 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         }
 
         // Generate random components.
+        //
+        // The values are generated by a counter-based generator, so that the
+        // value associated with each cell, node, or edge does not depend on the
+        // patch decomposition.  Each random component and each data centering
+        // uses a distinct stream.
         if (cycle_num == 0)
         {
+            const int step_num = d_fluid_solver->getIntegratorStep();
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
+                const int stream_num = (NDIM + 1) * k;
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
                 {
                     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
@@ -314,16 +308,24 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                     {
                         Pointer<Patch<NDIM> > patch = level->getPatch(p());
                         Pointer<CellData<NDIM, double> > W_cc_data = patch->getPatchData(d_W_cc_idxs[k]);
-                        genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        RNG::genrandn(W_cc_data->getArrayData(), W_cc_data->getBox(), step_num, level_num, stream_num);
 #if (NDIM == 2)
                         Pointer<NodeData<NDIM, double> > W_nc_data = patch->getPatchData(d_W_nc_idxs[k]);
-                        genrandn(W_nc_data->getArrayData(), NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()));
+                        RNG::genrandn(W_nc_data->getArrayData(),
+                                      NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()),
+                                      step_num,
+                                      level_num,
+                                      stream_num + 1);
 #endif
 #if (NDIM == 3)
                         Pointer<EdgeData<NDIM, double> > W_ec_data = patch->getPatchData(d_W_ec_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(W_ec_data->getArrayData(d), EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d));
+                            RNG::genrandn(W_ec_data->getArrayData(d),
+                                          EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d),
+                                          step_num,
+                                          level_num,
+                                          stream_num + 1 + d);
                         }
 #endif
                     }
@@ -90,6 +90,28 @@ KrylovLinearSolverStaggeredStokesSolverInterface::setVelocityPoissonSpecificatio
     return;
 } // setVelocityPoissonSpecifications
 
+bool
+KrylovLinearSolverStaggeredStokesSolverInterface::updateVelocityPoissonSpecifications(
+    const PoissonSpecifications& U_problem_coefs)
+{
+    KrylovLinearSolver* p_this = dynamic_cast<KrylovLinearSolver*>(this);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(p_this);
+#endif
+    // The operator uses the coefficients only when it is applied.
+    StaggeredStokesSolver::setVelocityPoissonSpecifications(U_problem_coefs);
+    Pointer<StaggeredStokesOperator> p_operator = p_this->getOperator();
+    if (p_operator) p_operator->setVelocityPoissonSpecifications(d_U_problem_coefs);
+    Pointer<StaggeredStokesSolver> p_preconditioner = p_this->getPreconditioner();
+    if (!p_this->getIsInitialized())
+    {
+        if (p_preconditioner) p_preconditioner->setVelocityPoissonSpecifications(d_U_problem_coefs);
+        return false;
+    }
+    if (p_preconditioner) return p_preconditioner->updateVelocityPoissonSpecifications(d_U_problem_coefs);
+    return true;
+} // updateVelocityPoissonSpecifications
+
 void
 KrylovLinearSolverStaggeredStokesSolverInterface::setComponentsHaveNullspace(const bool has_velocity_nullspace,
                                                                              const bool has_pressure_nullspace)
@@ -124,6 +124,16 @@ StaggeredStokesBlockPreconditioner::setVelocityPoissonSpecifications(const Poiss
     return;
 } // setVelocityPoissonSpecifications
 
+bool
+StaggeredStokesBlockPreconditioner::updateVelocityPoissonSpecifications(const PoissonSpecifications& U_problem_coefs)
+{
+    // The block preconditioners use the coefficients only when they are
+    // applied.  The velocity subdomain solver is initialized and updated
+    // separately.
+    setVelocityPoissonSpecifications(U_problem_coefs);
+    return d_is_initialized;
+} // updateVelocityPoissonSpecifications
+
 bool
 StaggeredStokesBlockPreconditioner::needsPressureSubdomainSolver() const
 {
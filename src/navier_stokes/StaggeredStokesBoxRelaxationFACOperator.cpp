@@ -298,150 +298,164 @@ buildBoxOperator(Mat& A,
     return;
 } // buildBoxOperator
 
+// Number of colors used by the multicolor box ordering.  Boxes of the same
+// color are separated by at least two cells in each coordinate direction and
+// so do not share any of the values read or written by the box solves.
+#if (NDIM == 2)
+static const int NUM_BOX_COLORS = 9;
+#endif
+#if (NDIM == 3)
+static const int NUM_BOX_COLORS = 27;
+#endif
+
+// Under-relaxation parameter used by the box smoother.
+static const double BOX_RELAXATION_OMEGA = 0.65;
+
 void
-modifyRhsForBcs(Vec& v,
-                const SideData<NDIM, double>& U_data,
-                const CellData<NDIM, double>& P_data,
-                const PoissonSpecifications& U_problem_coefs,
-                const Box<NDIM>& box,
-                const Box<NDIM>& ghost_box,
-                const double* const dx)
+computeBoxInverse(std::vector<double>& A_inv,
+                  const PoissonSpecifications& U_problem_coefs,
+                  const boost::array<double, NDIM>& dx)
 {
     int ierr;
 
-    const double D = U_problem_coefs.getDConstant();
+    // Factor the operator for a single cell and compute the columns of its
+    // inverse.
+    const Box<NDIM> box(Index<NDIM>(0), Index<NDIM>(0));
+    Mat A;
+    buildBoxOperator(A, U_problem_coefs, box, box, dx);
+    Vec e, r;
+    ierr = MatCreateVecs(A, &e, &r);
+    IBTK_CHKERRQ(ierr);
+    KSP ksp;
+    ierr = KSPCreate(PETSC_COMM_SELF, &ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetOperators(ksp, A, A);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetType(ksp, KSPPREONLY);
+    IBTK_CHKERRQ(ierr);
+    PC pc;
+    ierr = KSPGetPC(ksp, &pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCSetType(pc, PCLU);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCFactorReorderForNonzeroDiagonal(pc, std::numeric_limits<double>::epsilon());
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetUp(ksp);
+    IBTK_CHKERRQ(ierr);
+
+    static const int n = 2 * NDIM + 1;
+    A_inv.resize(n * n);
+    for (int col = 0; col < n; ++col)
+    {
+        ierr = VecSet(r, 0.0);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecSetValue(r, col, 1.0, INSERT_VALUES);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAssemblyBegin(r);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAssemblyEnd(r);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSolve(ksp, r, e);
+        IBTK_CHKERRQ(ierr);
+        const double* e_arr;
+        ierr = VecGetArrayRead(e, &e_arr);
+        IBTK_CHKERRQ(ierr);
+        for (int row = 0; row < n; ++row)
+        {
+            A_inv[row * n + col] = e_arr[row];
+        }
+        ierr = VecRestoreArrayRead(e, &e_arr);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    ierr = KSPDestroy(&ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&e);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&r);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatDestroy(&A);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // computeBoxInverse
+
+inline void
+relaxBox(SideData<NDIM, double>& U_error_data,
+         CellData<NDIM, double>& P_error_data,
+         const SideData<NDIM, double>& U_residual_data,
+         const CellData<NDIM, double>& P_residual_data,
+         const Index<NDIM>& i,
+         const double* const A_inv,
+         const double D,
+         const double* const dx)
+{
+    // The local unknowns are ordered as the lower and upper side-centered
+    // velocities along each axis followed by the cell-centered pressure.
+    static const int n = 2 * NDIM + 1;
+    double r[n], e[n];
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        for (int upper = 0; upper <= 1; ++upper)
         {
-            Index<NDIM> i = b();
-            const int idx = compute_side_index(i, ghost_box, axis);
+            Index<NDIM> i_s = i;
+            i_s(axis) += upper;
+            const int k = 2 * axis + upper;
+            r[k] = U_residual_data(SideIndex<NDIM>(i_s, axis, SideIndex<NDIM>::Lower));
 
+            // Account for values outside the box, which are held fixed.
             for (unsigned int d = 0; d < NDIM; ++d)
             {
+                const double fac = D / (dx[d] * dx[d]);
                 Index<NDIM> shift = 0;
                 shift(d) = 1;
-                const Index<NDIM> u_left = i - shift;
-                const Index<NDIM> u_rght = i + shift;
-                if (!side_box.contains(u_left))
+                if (d != axis || !upper)
                 {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_left, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
+                    r[k] += fac * U_error_data(SideIndex<NDIM>(i_s - shift, axis, SideIndex<NDIM>::Lower));
                 }
-                if (!side_box.contains(u_rght))
+                if (d != axis || upper)
                 {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_rght, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
+                    r[k] += fac * U_error_data(SideIndex<NDIM>(i_s + shift, axis, SideIndex<NDIM>::Lower));
                 }
             }
-
             Index<NDIM> shift = 0;
             shift(axis) = 1;
-            const Index<NDIM> p_left = i - shift;
-            const Index<NDIM> p_rght = i;
-            if (!box.contains(p_left))
+            if (upper)
             {
-                ierr = VecSetValue(v, idx, +P_data(p_left) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
+                r[k] -= P_error_data(i_s) / dx[axis];
             }
-            if (!box.contains(p_rght))
+            else
             {
-                ierr = VecSetValue(v, idx, -P_data(p_rght) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
+                r[k] += P_error_data(i_s - shift) / dx[axis];
             }
         }
     }
+    r[2 * NDIM] = P_residual_data(i);
 
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // modifyRhsForBcs
-
-inline void
-copyToVec(Vec& v,
-          const SideData<NDIM, double>& U_data,
-          const CellData<NDIM, double>& P_data,
-          const Box<NDIM>& box,
-          const Box<NDIM>& ghost_box)
-{
-    int ierr;
-
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    // Solve the local system using the precomputed inverse.
+    for (int row = 0; row < n; ++row)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        e[row] = 0.0;
+        for (int col = 0; col < n; ++col)
         {
-            const Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, 0);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecSetValue(v, idx, U_data(s_i), INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
+            e[row] += A_inv[row * n + col] * r[col];
         }
     }
 
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        const Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecSetValue(v, idx, P_data(i), INSERT_VALUES);
-        IBTK_CHKERRQ(ierr);
-    }
-
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // copyToVec
-
-inline void
-copyFromVec(Vec& v,
-            SideData<NDIM, double>& U_data,
-            CellData<NDIM, double>& P_data,
-            const Box<NDIM>& box,
-            const Box<NDIM>& ghost_box)
-{
-    int ierr;
-
-    const double omega = 0.65;
-
-    double U;
+    // Update the error with under-relaxation.
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        for (int upper = 0; upper <= 1; ++upper)
         {
-            const Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, SideIndex<NDIM>::Lower);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecGetValues(v, 1, &idx, &U);
-            IBTK_CHKERRQ(ierr);
-            U_data(s_i) = (1.0 - omega) * U_data(s_i) + omega * U;
+            Index<NDIM> i_s = i;
+            i_s(axis) += upper;
+            const SideIndex<NDIM> s_i(i_s, axis, SideIndex<NDIM>::Lower);
+            U_error_data(s_i) =
+                (1.0 - BOX_RELAXATION_OMEGA) * U_error_data(s_i) + BOX_RELAXATION_OMEGA * e[2 * axis + upper];
         }
     }
-
-    double P;
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        const Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecGetValues(v, 1, &idx, &P);
-        IBTK_CHKERRQ(ierr);
-        P_data(i) = (1.0 - omega) * P_data(i) + omega * P;
-    }
+    P_error_data(i) = (1.0 - BOX_RELAXATION_OMEGA) * P_error_data(i) + BOX_RELAXATION_OMEGA * e[2 * NDIM];
     return;
-} // copyFromVec
+} // relaxBox
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -451,14 +465,24 @@ StaggeredStokesBoxRelaxationFACOperator::StaggeredStokesBoxRelaxationFACOperator
     const Pointer<Database> input_db,
     const std::string& default_options_prefix)
     : StaggeredStokesFACPreconditionerStrategy(object_name, GHOSTS, input_db, default_options_prefix),
-      d_box_op(),
-      d_box_e(),
-      d_box_r(),
-      d_box_ksp(),
+      d_box_ordering("LEXICOGRAPHIC"),
+      d_box_inv(),
       d_patch_side_bc_box_overlap(),
       d_patch_cell_bc_box_overlap()
 {
-    // intentionally blank
+    if (input_db)
+    {
+        if (input_db->keyExists("box_ordering")) d_box_ordering = input_db->getString("box_ordering");
+    }
+    if (d_box_ordering != "LEXICOGRAPHIC" && d_box_ordering != "MULTICOLOR")
+    {
+        TBOX_ERROR(d_object_name << "::StaggeredStokesBoxRelaxationFACOperator():\n"
+                                 << "  unsupported box ordering: "
+                                 << d_box_ordering
+                                 << "\n"
+                                 << "  supported box orderings are: LEXICOGRAPHIC and MULTICOLOR"
+                                 << std::endl);
+    }
     return;
 } // StaggeredStokesBoxRelaxationFACOperator
 
@@ -468,6 +492,31 @@ StaggeredStokesBoxRelaxationFACOperator::~StaggeredStokesBoxRelaxationFACOperato
     return;
 } // ~StaggeredStokesBoxRelaxationFACOperator
 
+bool
+StaggeredStokesBoxRelaxationFACOperator::updateVelocityPoissonSpecifications(
+    const PoissonSpecifications& U_problem_coefs)
+{
+    setVelocityPoissonSpecifications(U_problem_coefs);
+    if (!d_is_initialized) return false;
+
+    // Recompute the inverse of the box operator on each level of the patch
+    // hierarchy.
+    Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
+    const double* const dx_coarsest = geometry->getDx();
+    boost::array<double, NDIM> dx;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(ln)->getRatio();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+        }
+        computeBoxInverse(d_box_inv[ln], d_U_problem_coefs, dx);
+    }
+    if (d_coarse_solver) return d_coarse_solver->updateVelocityPoissonSpecifications(d_U_problem_coefs);
+    return true;
+} // updateVelocityPoissonSpecifications
+
 void
 StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>& error,
                                                      const SAMRAIVectorReal<NDIM, double>& residual,
@@ -478,7 +527,6 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
 {
     if (num_sweeps == 0) return;
 
-    int ierr;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int U_error_idx = error.getComponentDescriptorIndex(0);
     const int P_error_idx = error.getComponentDescriptorIndex(1);
@@ -591,9 +639,8 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
         }
 
         // Smooth the error on the patches.
-        Vec& e = d_box_e[level_num];
-        Vec& r = d_box_r[level_num];
-        KSP& ksp = d_box_ksp[level_num];
+        const double* const A_inv = &d_box_inv[level_num][0];
+        const double D = d_U_problem_coefs.getDConstant();
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
         {
@@ -618,16 +665,43 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
             const double* const dx = pgeom->getDx();
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            if (d_box_ordering == "LEXICOGRAPHIC")
             {
-                const Index<NDIM>& i = b();
-                const Box<NDIM> box(i, i);
-                copyToVec(e, *U_error_data, *P_error_data, box, box);
-                copyToVec(r, *U_residual_data, *P_residual_data, box, box);
-                modifyRhsForBcs(r, *U_error_data, *P_error_data, d_U_problem_coefs, box, box, dx);
-                ierr = KSPSolve(ksp, r, e);
-                IBTK_CHKERRQ(ierr);
-                copyFromVec(e, *U_error_data, *P_error_data, box, box);
+                for (Box<NDIM>::Iterator b(patch_box); b; b++)
+                {
+                    relaxBox(*U_error_data, *P_error_data, *U_residual_data, *P_residual_data, b(), A_inv, D, dx);
+                }
+            }
+            else if (d_box_ordering == "MULTICOLOR")
+            {
+                // Boxes of the same color are independent, so the boxes of
+                // each color may be relaxed concurrently.
+                const Index<NDIM>& patch_lower = patch_box.lower();
+                const IntVector<NDIM> patch_extent = patch_box.numberCells();
+                for (int color = 0; color < NUM_BOX_COLORS; ++color)
+                {
+                    IntVector<NDIM> color_offset, color_extent;
+                    int num_color_boxes = 1;
+                    for (unsigned int d = 0, c = color; d < NDIM; ++d, c /= 3)
+                    {
+                        color_offset(d) = c % 3;
+                        color_extent(d) = std::max(0, (patch_extent(d) - color_offset(d) + 2) / 3);
+                        num_color_boxes *= color_extent(d);
+                    }
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+                    for (int k = 0; k < num_color_boxes; ++k)
+                    {
+                        Index<NDIM> i;
+                        for (unsigned int d = 0, kk = k; d < NDIM; ++d)
+                        {
+                            i(d) = patch_lower(d) + color_offset(d) + 3 * (kk % color_extent(d));
+                            kk /= color_extent(d);
+                        }
+                        relaxBox(*U_error_data, *P_error_data, *U_residual_data, *P_residual_data, i, A_inv, D, dx);
+                    }
+                }
             }
         }
     }
@@ -647,12 +721,9 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
                                                                             const int coarsest_reset_ln,
                                                                             const int finest_reset_ln)
 {
-    // Initialize the box relaxation data on each level of the patch hierarchy.
-    d_box_op.resize(d_finest_ln + 1);
-    d_box_e.resize(d_finest_ln + 1);
-    d_box_r.resize(d_finest_ln + 1);
-    d_box_ksp.resize(d_finest_ln + 1);
-    const Box<NDIM> box(Index<NDIM>(0), Index<NDIM>(0));
+    // Compute the inverse of the box operator on each level of the patch
+    // hierarchy.
+    d_box_inv.resize(d_finest_ln + 1);
     Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
     const double* const dx_coarsest = geometry->getDx();
     boost::array<double, NDIM> dx;
@@ -663,27 +734,7 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
         {
             dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
         }
-        buildBoxOperator(d_box_op[ln], d_U_problem_coefs, box, box, dx);
-        int ierr;
-        ierr = MatCreateVecs(d_box_op[ln], &d_box_e[ln], &d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPCreate(PETSC_COMM_SELF, &d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetOperators(d_box_ksp[ln], d_box_op[ln], d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetReusePreconditioner(d_box_ksp[ln], PETSC_TRUE);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetType(d_box_ksp[ln], KSPPREONLY);
-        IBTK_CHKERRQ(ierr);
-        PC box_pc;
-        ierr = KSPGetPC(d_box_ksp[ln], &box_pc);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCSetType(box_pc, PCLU);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCFactorReorderForNonzeroDiagonal(box_pc, std::numeric_limits<double>::epsilon());
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetUp(d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
+        computeBoxInverse(d_box_inv[ln], d_U_problem_coefs, dx);
     }
 
     // Get overlap information for setting patch boundary conditions.
@@ -737,15 +788,7 @@ StaggeredStokesBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(cons
     if (!d_is_initialized) return;
     for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
     {
-        int ierr;
-        ierr = MatDestroy(&d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_e[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPDestroy(&d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
+        d_box_inv[ln].clear();
         d_patch_side_bc_box_overlap[ln].resize(0);
         d_patch_cell_bc_box_overlap[ln].resize(0);
     }
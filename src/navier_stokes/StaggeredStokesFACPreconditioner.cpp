@@ -81,6 +81,19 @@ StaggeredStokesFACPreconditioner::setVelocityPoissonSpecifications(const Poisson
     return;
 } // setVelocityPoissonSpecifications
 
+bool
+StaggeredStokesFACPreconditioner::updateVelocityPoissonSpecifications(const PoissonSpecifications& U_problem_coefs)
+{
+    StaggeredStokesSolver::setVelocityPoissonSpecifications(U_problem_coefs);
+    Pointer<StaggeredStokesFACPreconditionerStrategy> p_fac_strategy = d_fac_strategy;
+    if (!d_is_initialized || !p_fac_strategy)
+    {
+        if (p_fac_strategy) p_fac_strategy->setVelocityPoissonSpecifications(U_problem_coefs);
+        return false;
+    }
+    return p_fac_strategy->updateVelocityPoissonSpecifications(U_problem_coefs);
+} // updateVelocityPoissonSpecifications
+
 void
 StaggeredStokesFACPreconditioner::setComponentsHaveNullspace(const bool has_velocity_nullspace,
                                                              const bool has_pressure_nullspace)
@@ -275,6 +275,14 @@ StaggeredStokesFACPreconditionerStrategy::setVelocityPoissonSpecifications(const
     return;
 } // setVelocityPoissonSpecifications
 
+bool
+StaggeredStokesFACPreconditionerStrategy::updateVelocityPoissonSpecifications(
+    const PoissonSpecifications& U_problem_coefs)
+{
+    setVelocityPoissonSpecifications(U_problem_coefs);
+    return false;
+} // updateVelocityPoissonSpecifications
+
 void
 StaggeredStokesFACPreconditionerStrategy::setComponentsHaveNullspace(const bool has_velocity_nullspace,
                                                                      const bool has_pressure_nullspace)
@@ -44,6 +44,7 @@
 #include "MultiblockDataTranslator.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "PoissonSpecifications.h"
 #include "RefineSchedule.h"
 #include "SAMRAIVectorReal.h"
 #include "SideVariable.h"
@@ -58,6 +59,7 @@
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/PETScLevelSolver.h"
 #include "ibtk/PoissonUtilities.h"
+#include "petscksp.h"
 #include "petscmat.h"
 #include "petscsys.h"
 #include "petscvec.h"
@@ -148,6 +150,35 @@ StaggeredStokesPETScLevelSolver::~StaggeredStokesPETScLevelSolver()
     return;
 } // ~StaggeredStokesPETScLevelSolver
 
+bool
+StaggeredStokesPETScLevelSolver::updateVelocityPoissonSpecifications(const PoissonSpecifications& U_problem_coefs)
+{
+    setVelocityPoissonSpecifications(U_problem_coefs);
+    if (!d_is_initialized || d_pc_type == "shell") return false;
+
+    // Recompute the matrix values using the existing nonzero structure.
+    StaggeredStokesPETScMatUtilities::updatePatchLevelMACStokesOp(d_petsc_mat,
+                                                                  d_U_problem_coefs,
+                                                                  d_U_bc_coefs,
+                                                                  d_new_time,
+                                                                  d_num_dofs_per_proc,
+                                                                  d_u_dof_index_idx,
+                                                                  d_p_dof_index_idx,
+                                                                  d_level);
+
+    // Set up the preconditioner again.  Because the nonzero structure of the
+    // matrix is unchanged, PETSc only needs to recompute its numerical values
+    // (e.g., the subdomain factorizations).
+    int ierr;
+    ierr = KSPSetReusePreconditioner(d_petsc_ksp, PETSC_FALSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetUp(d_petsc_ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetReusePreconditioner(d_petsc_ksp, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    return true;
+} // updateVelocityPoissonSpecifications
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -196,17 +227,16 @@ StaggeredStokesPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVe
     IBTK_CHKERRQ(ierr);
     ierr = VecCreateMPI(PETSC_COMM_WORLD, d_num_dofs_per_proc[mpi_rank], PETSC_DETERMINE, &d_petsc_b);
     IBTK_CHKERRQ(ierr);
-        StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(d_petsc_mat,
-                                                                         d_U_problem_coefs,
-                                                                         d_U_bc_coefs,
-                                                                         d_new_time,
-                                                                         d_num_dofs_per_proc,
-                                                                         d_u_dof_index_idx,
-                                                                         d_p_dof_index_idx,
-                                                                         d_level);
+    StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(d_petsc_mat,
+                                                                     d_U_problem_coefs,
+                                                                     d_U_bc_coefs,
+                                                                     d_new_time,
+                                                                     d_num_dofs_per_proc,
+                                                                     d_u_dof_index_idx,
+                                                                     d_p_dof_index_idx,
+                                                                     d_level);
     d_petsc_pc = d_petsc_mat;
 
-
     // Set pressure nullspace if the level covers the entire domain.
     if (d_has_pressure_nullspace)
     {
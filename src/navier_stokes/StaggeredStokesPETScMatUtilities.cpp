@@ -108,833 +108,892 @@ StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
     int p_dof_index_idx,
     Pointer<PatchLevel<NDIM> > patch_level)
 {
-    int ierr;
     if (mat)
     {
-        ierr = MatDestroy(&mat);
+        int ierr = MatDestroy(&mat);
         IBTK_CHKERRQ(ierr);
     }
+    constructPatchLevelMACStokesOp_impl(mat,
+                                        /*reuse_nonzero_pattern*/ false,
+                                        u_problem_coefs,
+                                        u_bc_coefs,
+                                        data_time,
+                                        num_dofs_per_proc,
+                                        u_dof_index_idx,
+                                        p_dof_index_idx,
+                                        patch_level);
+    return;
+} // constructPatchLevelMACStokesOp
 
-    // Setup the finite difference stencils.
-    static const int uu_stencil_sz = 2 * NDIM + 1;
-    boost::array<Index<NDIM>, uu_stencil_sz> uu_stencil(array_constant<Index<NDIM>, uu_stencil_sz>(Index<NDIM>(0)));
-    for (unsigned int axis = 0, uu_stencil_index = 1; axis < NDIM; ++axis)
+void
+StaggeredStokesPETScMatUtilities::updatePatchLevelMACStokesOp(
+    Mat& mat,
+    const PoissonSpecifications& u_problem_coefs,
+    const std::vector<RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+    double data_time,
+    const std::vector<int>& num_dofs_per_proc,
+    int u_dof_index_idx,
+    int p_dof_index_idx,
+    Pointer<PatchLevel<NDIM> > patch_level)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mat);
+#endif
+    constructPatchLevelMACStokesOp_impl(mat,
+                                        /*reuse_nonzero_pattern*/ true,
+                                        u_problem_coefs,
+                                        u_bc_coefs,
+                                        data_time,
+                                        num_dofs_per_proc,
+                                        u_dof_index_idx,
+                                        p_dof_index_idx,
+                                        patch_level);
+    return;
+} // updatePatchLevelMACStokesOp
+
+void
+StaggeredStokesPETScMatUtilities::constructPatchLevelASMSubdomains(std::vector<std::set<int> >& is_overlap,
+                                                                   std::vector<std::set<int> >& is_nonoverlap,
+                                                                   const IntVector<NDIM>& box_size,
+                                                                   const IntVector<NDIM>& overlap_size,
+                                                                   const std::vector<int>& /*num_dofs_per_proc*/,
+                                                                   int u_dof_index_idx,
+                                                                   int p_dof_index_idx,
+                                                                   Pointer<PatchLevel<NDIM> > patch_level,
+                                                                   Pointer<CoarseFineBoundary<NDIM> > /*cf_boundary*/)
+{
+    // Clear previously stored index sets.
+    for (unsigned int k = 0; k < is_overlap.size(); ++k)
     {
-        for (int side = 0; side <= 1; ++side, ++uu_stencil_index)
-        {
-            uu_stencil[uu_stencil_index](axis) = (side == 0 ? -1 : +1);
-        }
+        is_overlap[k].clear();
     }
-    static const int up_stencil_sz = 2;
-    boost::array<boost::array<Index<NDIM>, up_stencil_sz>, NDIM> up_stencil(
-        array_constant<boost::array<Index<NDIM>, up_stencil_sz>, NDIM>(
-            array_constant<Index<NDIM>, up_stencil_sz>(Index<NDIM>(0))));
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    is_overlap.clear();
+    for (unsigned int k = 0; k < is_nonoverlap.size(); ++k)
     {
-        for (int side = 0; side <= 1; ++side)
-        {
-            up_stencil[axis][side](axis) = (side == 0 ? -1 : 0);
-        }
+        is_nonoverlap[k].clear();
     }
-    static const int pu_stencil_sz = 2 * NDIM;
-    boost::array<Index<NDIM>, pu_stencil_sz> pu_stencil(array_constant<Index<NDIM>, pu_stencil_sz>(Index<NDIM>(0)));
-    for (unsigned int axis = 0, pu_stencil_index = 0; axis < NDIM; ++axis)
+    is_nonoverlap.clear();
+
+    // Create variables to keep track of whether a particular velocity location
+    // is the "master" location.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<SideVariable<NDIM, int> > patch_num_var = new SideVariable<NDIM, int>(
+        "StaggeredStokesPETScMatUtilities::constructPatchLevelASMSubdomains()::patch_num_var");
+    static const int patch_num_idx = var_db->registerPatchDataIndex(patch_num_var);
+    patch_level->allocatePatchData(patch_num_idx);
+    Pointer<SideVariable<NDIM, bool> > u_mastr_loc_var = new SideVariable<NDIM, bool>(
+        "StaggeredStokesPETScMatUtilities::constructPatchLevelASMSubdomains()::u_mastr_loc_var");
+    static const int u_mastr_loc_idx = var_db->registerPatchDataIndex(u_mastr_loc_var);
+    patch_level->allocatePatchData(u_mastr_loc_idx);
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
-        for (int side = 0; side <= 1; ++side, ++pu_stencil_index)
-        {
-            pu_stencil[pu_stencil_index](axis) = (side == 0 ? 0 : +1);
-        }
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const int patch_num = patch->getPatchNumber();
+        Pointer<SideData<NDIM, int> > patch_num_data = patch->getPatchData(patch_num_idx);
+        Pointer<SideData<NDIM, bool> > u_mastr_loc_data = patch->getPatchData(u_mastr_loc_idx);
+        patch_num_data->fillAll(patch_num);
+        u_mastr_loc_data->fillAll(false);
     }
 
-    // Determine the index ranges.
-    const int mpi_rank = SAMRAI_MPI::getRank();
-    const int nlocal = num_dofs_per_proc[mpi_rank];
-    const int ilower = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
-    const int iupper = ilower + nlocal;
-    const int ntotal = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
+    // Synchronize the patch number at patch boundaries to determine which patch
+    // owns a given DOF along patch boundaries.
+    RefineAlgorithm<NDIM> bdry_synch_alg;
+    bdry_synch_alg.registerRefine(patch_num_idx, patch_num_idx, patch_num_idx, NULL, new SideSynchCopyFillPattern());
+    bdry_synch_alg.createSchedule(patch_level)->fillData(0.0);
+
+    // For a single patch in a periodic domain, the far side DOFs are not master.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_level->getGridGeometry();
+    IntVector<NDIM> periodic_shift = grid_geom->getPeriodicShift(patch_level->getRatio());
+    const BoxArray<NDIM>& domain_boxes = patch_level->getPhysicalDomain();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(domain_boxes.size() == 1);
+#endif
+    const Index<NDIM>& domain_upper = domain_boxes[0].upper();
 
-    // Determine the non-zero structure of the matrix.
-    std::vector<int> d_nnz(nlocal, 0), o_nnz(nlocal, 0);
+    // Determine the number of local DOFs.
+    int local_dof_count = 0;
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const int patch_num = patch->getPatchNumber();
         const Box<NDIM>& patch_box = patch->getBox();
+        const IntVector<NDIM> patch_size = patch_box.numberCells();
+
         Pointer<SideData<NDIM, int> > u_dof_index_data = patch->getPatchData(u_dof_index_idx);
-        Pointer<CellData<NDIM, int> > p_dof_index_data = patch->getPatchData(p_dof_index_idx);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
-            {
-                const CellIndex<NDIM>& ic = b();
-                const SideIndex<NDIM> is(ic, axis, SideIndex<NDIM>::Lower);
-                const int u_dof_index = (*u_dof_index_data)(is);
-                if (UNLIKELY(ilower > u_dof_index || u_dof_index >= iupper)) continue;
-                const int u_local_idx = u_dof_index - ilower;
-                d_nnz[u_local_idx] += 1;
-                for (unsigned int d = 0, uu_stencil_index = 1; d < NDIM; ++d)
-                {
-                    for (int side = 0; side <= 1; ++side, ++uu_stencil_index)
-                    {
-                        const int uu_dof_index = (*u_dof_index_data)(is + uu_stencil[uu_stencil_index]);
-                        if (LIKELY(uu_dof_index >= ilower && uu_dof_index < iupper))
-                        {
-                            d_nnz[u_local_idx] += 1;
-                        }
-                        else
-                        {
-                            o_nnz[u_local_idx] += 1;
-                        }
-                    }
-                }
-                for (int side = 0, up_stencil_index = 0; side <= 1; ++side, ++up_stencil_index)
-                {
-                    const int up_dof_index = (*p_dof_index_data)(ic + up_stencil[axis][up_stencil_index]);
-                    if (LIKELY(up_dof_index >= ilower && up_dof_index < iupper))
-                    {
-                        d_nnz[u_local_idx] += 1;
-                    }
-                    else
-                    {
-                        o_nnz[u_local_idx] += 1;
-                    }
-                }
-                d_nnz[u_local_idx] = std::min(nlocal, d_nnz[u_local_idx]);
-                o_nnz[u_local_idx] = std::min(ntotal - nlocal, o_nnz[u_local_idx]);
-            }
-        }
-        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
+        Pointer<SideData<NDIM, int> > patch_num_data = patch->getPatchData(patch_num_idx);
+        Pointer<SideData<NDIM, bool> > u_mastr_loc_data = patch->getPatchData(u_mastr_loc_idx);
+        for (unsigned int component_axis = 0; component_axis < NDIM; ++component_axis)
         {
-            const CellIndex<NDIM>& ic = b();
-            const int p_dof_index = (*p_dof_index_data)(ic);
-            if (UNLIKELY(ilower > p_dof_index || p_dof_index >= iupper)) continue;
-            const int p_local_idx = p_dof_index - ilower;
-            d_nnz[p_local_idx] += 1;
-            for (unsigned int axis = 0, pu_stencil_index = 0; axis < NDIM; ++axis)
+            const int upper_domain_side_idx = domain_upper(component_axis) + 1;
+            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, component_axis)); b; b++)
             {
-                for (int side = 0; side <= 1; ++side, ++pu_stencil_index)
+                const CellIndex<NDIM>& i = b();
+                const SideIndex<NDIM> is(i, component_axis, SideIndex<NDIM>::Lower);
+                bool fully_periodic_patch_in_axis =
+                    periodic_shift(component_axis) && (patch_size(component_axis) == periodic_shift(component_axis));
+                bool periodic_image = fully_periodic_patch_in_axis && (i(component_axis) == upper_domain_side_idx);
+                if ((*patch_num_data)(is) == patch_num && !periodic_image)
                 {
-                    const int pu_dof_index = (*u_dof_index_data)(
-                        SideIndex<NDIM>(ic + pu_stencil[pu_stencil_index], axis, SideIndex<NDIM>::Lower));
-                    if (LIKELY(pu_dof_index >= ilower && pu_dof_index < iupper))
-                    {
-                        d_nnz[p_local_idx] += 1;
-                    }
-                    else
-                    {
-                        o_nnz[p_local_idx] += 1;
-                    }
+                    (*u_mastr_loc_data)(is) = true;
+                    ++local_dof_count;
                 }
             }
-            d_nnz[p_local_idx] = std::min(nlocal, d_nnz[p_local_idx]);
-            o_nnz[p_local_idx] = std::min(ntotal - nlocal, o_nnz[p_local_idx]);
         }
+        local_dof_count += CellGeometry<NDIM>::toCellBox(patch_box).size();
     }
 
-    // Create an empty matrix.
-    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                        nlocal,
-                        nlocal,
-                        PETSC_DETERMINE,
-                        PETSC_DETERMINE,
-                        0,
-                        nlocal ? &d_nnz[0] : NULL,
-                        0,
-                        nlocal ? &o_nnz[0] : NULL,
-                        &mat);
-    IBTK_CHKERRQ(ierr);
-
-// Set some general matrix options.
-#if !defined(NDEBUG)
-    ierr = MatSetOption(mat, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatSetOption(mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-#endif
-
-    // Set the matrix coefficients.
-    const double C = u_problem_coefs.getCConstant();
-    const double D = u_problem_coefs.getDConstant();
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    // Determine the subdomains associated with this processor.
+    const int n_local_patches = patch_level->getProcessorMapping().getNumberOfLocalIndices();
+    std::vector<std::vector<Box<NDIM> > > overlap_boxes(n_local_patches), nonoverlap_boxes(n_local_patches);
+    int patch_counter = 0, subdomain_counter = 0;
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++, ++patch_counter)
     {
         Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
-        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-        const double* const dx = pgeom->getDx();
-
-        const IntVector<NDIM> no_ghosts(0);
-        SideData<NDIM, double> uu_matrix_coefs(patch_box, uu_stencil_sz, no_ghosts);
-        SideData<NDIM, double> up_matrix_coefs(patch_box, up_stencil_sz, no_ghosts);
-        CellData<NDIM, double> pu_matrix_coefs(patch_box, pu_stencil_sz, no_ghosts);
+        IndexUtilities::partitionPatchBox(
+            overlap_boxes[patch_counter], nonoverlap_boxes[patch_counter], patch_box, box_size, overlap_size);
+        subdomain_counter += overlap_boxes[patch_counter].size();
+    }
+    is_overlap.resize(subdomain_counter);
+    is_nonoverlap.resize(subdomain_counter);
 
-        // Compute all matrix coefficients, including those on the physical
-        // boundary; however, do not yet take physical boundary conditions into
-        // account.  Boundary conditions are handled subsequently.
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
+    // Fill in the IS'es.
+    int nonoverlap_dof_counter = 0;
+    subdomain_counter = 0, patch_counter = 0;
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++, ++patch_counter)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Box<NDIM> side_patch_box[NDIM];
+        for (int axis = 0; axis < NDIM; ++axis)
         {
-            std::vector<double> uu_mat_vals(uu_stencil_sz, 0.0);
-            uu_mat_vals[0] = C; // diagonal
-            for (unsigned int d = 0; d < NDIM; ++d)
+            side_patch_box[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+        }
+        Pointer<SideData<NDIM, bool> > u_mastr_loc_data = patch->getPatchData(u_mastr_loc_idx);
+        Pointer<SideData<NDIM, int> > u_dof_data = patch->getPatchData(u_dof_index_idx);
+        const int u_data_depth = u_dof_data->getDepth();
+        Pointer<CellData<NDIM, int> > p_dof_data = patch->getPatchData(p_dof_index_idx);
+        const int p_data_depth = p_dof_data->getDepth();
+#if !defined(NDEBUG)
+        TBOX_ASSERT(u_data_depth == 1);
+        TBOX_ASSERT(p_data_depth == 1);
+        TBOX_ASSERT(u_dof_data->getGhostCellWidth().min() >= overlap_size.max());
+        TBOX_ASSERT(p_dof_data->getGhostCellWidth().min() >= overlap_size.max());
+#endif
+        int n_patch_subdomains = static_cast<int>(nonoverlap_boxes[patch_counter].size());
+        for (int k = 0; k < n_patch_subdomains; ++k, ++subdomain_counter)
+        {
+            // The nonoverlapping subdomains.
+            const Box<NDIM>& sub_box = nonoverlap_boxes[patch_counter][k];
+            Box<NDIM> side_sub_box[NDIM];
+            for (int axis = 0; axis < NDIM; ++axis)
             {
-                const double dx_sq = dx[d] * dx[d];
-                uu_mat_vals[0] -= 2 * D / dx_sq;    // diagonal
-                uu_mat_vals[2 * d + 1] = D / dx_sq; // lower off-diagonal
-                uu_mat_vals[2 * d + 2] = D / dx_sq; // upper off-diagonal
+                side_sub_box[axis] = SideGeometry<NDIM>::toSideBox(sub_box, axis);
             }
-            for (int uu_stencil_index = 0; uu_stencil_index < uu_stencil_sz; ++uu_stencil_index)
+
+            // Get the local DOFs.
+            for (int axis = 0; axis < NDIM; ++axis)
             {
-                uu_matrix_coefs.fill(uu_mat_vals[uu_stencil_index], uu_stencil_index);
+                for (Box<NDIM>::Iterator b(side_sub_box[axis]); b; b++)
+                {
+                    const SideIndex<NDIM> i_s(b(), axis, SideIndex<NDIM>::Lower);
+                    const bool at_upper_subdomain_bdry = (i_s(axis) == side_sub_box[axis].upper(axis));
+                    const bool at_upper_patch_bdry = (i_s(axis) == side_patch_box[axis].upper(axis));
+                    if (!at_upper_subdomain_bdry || (at_upper_patch_bdry && (*u_mastr_loc_data)(i_s)))
+                    {
+                        const int dof_idx = (*u_dof_data)(i_s);
+                        if (dof_idx >= 0) is_nonoverlap[subdomain_counter].insert(dof_idx);
+                    }
+                }
             }
-
-            // grad p
-            for (int d = 0; d < NDIM; ++d)
+            for (Box<NDIM>::Iterator b(sub_box); b; b++)
             {
-                up_matrix_coefs.getArrayData(d).fill(-1.0 / dx[d], 0);
-                up_matrix_coefs.getArrayData(d).fill(+1.0 / dx[d], 1);
+                const CellIndex<NDIM>& i = b();
+                const int dof_idx = (*p_dof_data)(i);
+                if (dof_idx >= 0) is_nonoverlap[subdomain_counter].insert(dof_idx);
             }
+            const int n_nonoverlap = static_cast<int>(is_nonoverlap[subdomain_counter].size());
+            nonoverlap_dof_counter += n_nonoverlap;
 
-            // -div u
-            std::vector<double> pu_mat_vals(pu_stencil_sz, 0.0);
-            for (unsigned int d = 0; d < NDIM; ++d)
+            // The overlapping subdomains.
+            const Box<NDIM>& overlap_sub_box = overlap_boxes[patch_counter][k];
+            Box<NDIM> side_overlap_sub_box[NDIM];
+            for (int axis = 0; axis < NDIM; ++axis)
             {
-                pu_matrix_coefs.fill(+1.0 / dx[d], 2 * d);
-                pu_matrix_coefs.fill(-1.0 / dx[d], 2 * d + 1);
+                side_overlap_sub_box[axis] = SideGeometry<NDIM>::toSideBox(overlap_sub_box, axis);
             }
-        }
 
-        // Data structures required to set physical boundary conditions.
-        const Array<BoundaryBox<NDIM> > physical_codim1_boxes =
-            PhysicalBoundaryUtilities::getPhysicalBoundaryCodim1Boxes(*patch);
-        const int n_physical_codim1_boxes = physical_codim1_boxes.size();
-        const double* const patch_x_lower = pgeom->getXLower();
-        const double* const patch_x_upper = pgeom->getXUpper();
-        const IntVector<NDIM>& ratio_to_level_zero = pgeom->getRatio();
-        Array<Array<bool> > touches_regular_bdry(NDIM), touches_periodic_bdry(NDIM);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            touches_regular_bdry[axis].resizeArray(2);
-            touches_periodic_bdry[axis].resizeArray(2);
-            for (int upperlower = 0; upperlower < 2; ++upperlower)
+            // Get the overlap DOFs.
+            for (int axis = 0; axis < NDIM; ++axis)
             {
-                touches_regular_bdry[axis][upperlower] = pgeom->getTouchesRegularBoundary(axis, upperlower);
-                touches_periodic_bdry[axis][upperlower] = pgeom->getTouchesPeriodicBoundary(axis, upperlower);
+                for (Box<NDIM>::Iterator b(side_overlap_sub_box[axis]); b; b++)
+                {
+                    const SideIndex<NDIM> i_s(b(), axis, SideIndex<NDIM>::Lower);
+                    const int dof_idx = (*u_dof_data)(i_s);
+                    if (dof_idx >= 0) is_overlap[subdomain_counter].insert(dof_idx);
+                }
+            }
+            for (Box<NDIM>::Iterator b(overlap_sub_box); b; b++)
+            {
+                const CellIndex<NDIM>& i = b();
+                const int dof_idx = (*p_dof_data)(i);
+                if (dof_idx >= 0) is_overlap[subdomain_counter].insert(dof_idx);
             }
         }
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(local_dof_count == nonoverlap_dof_counter);
+#endif
 
-        // Modify matrix coefficients to account for physical boundary
-        // conditions along boundaries which ARE NOT aligned with the data axis.
-        //
-        // NOTE: It important to set these values first to avoid problems at
-        // corners in the physical domain.  In particular, since Dirichlet
-        // boundary conditions for values located on the physical boundary
-        // override all other boundary conditions, we set those values last.
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (int n = 0; n < n_physical_codim1_boxes; ++n)
-            {
-                const BoundaryBox<NDIM>& bdry_box = physical_codim1_boxes[n];
-                const unsigned int location_index = bdry_box.getLocationIndex();
-                const unsigned int bdry_normal_axis = location_index / 2;
-                const bool is_lower = location_index % 2 == 0;
+    // Deallocate patch_num variable data.
+    patch_level->deallocatePatchData(patch_num_idx);
+    patch_level->deallocatePatchData(u_mastr_loc_idx);
+    return;
+} // constructPatchLevelASMSubdomains
 
-                if (bdry_normal_axis == axis) continue;
+void
+StaggeredStokesPETScMatUtilities::constructPatchLevelFields(
+    std::vector<std::set<int> >& is_field,
+    std::vector<std::string>& is_field_name,
+    const std::vector<int>& num_dofs_per_proc,
+    int u_dof_index_idx,
+    int p_dof_index_idx,
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level)
+{
+    // Destroy the previously stored IS'es
+    for (unsigned int k = 0; k < is_field.size(); ++k)
+    {
+        is_field[k].clear();
+    }
+    is_field.clear();
+    is_field_name.clear();
 
-                const Box<NDIM> bc_fill_box =
-                    pgeom->getBoundaryFillBox(bdry_box, patch_box, /* ghost_width_to_fill */ IntVector<NDIM>(1));
-                const BoundaryBox<NDIM> trimmed_bdry_box =
-                    PhysicalBoundaryUtilities::trimBoundaryCodim1Box(bdry_box, *patch);
-                const Box<NDIM> bc_coef_box = compute_tangential_extension(
-                    PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box), axis);
+    // Resize vectors
+    is_field.resize(2);
+    is_field_name.resize(2);
 
-                Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-                Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-                Pointer<ArrayData<NDIM, double> > gcoef_data;
+    // Name of the fields.
+    static const int U_FIELD_IDX = 0;
+    static const int P_FIELD_IDX = 1;
+    is_field_name[U_FIELD_IDX] = "velocity";
+    is_field_name[P_FIELD_IDX] = "pressure";
 
-                // Temporarily reset the patch geometry object associated with
-                // the patch so that boundary conditions are set at the correct
-                // spatial locations.
-                boost::array<double, NDIM> shifted_patch_x_lower, shifted_patch_x_upper;
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    shifted_patch_x_lower[d] = patch_x_lower[d];
-                    shifted_patch_x_upper[d] = patch_x_upper[d];
-                }
-                shifted_patch_x_lower[axis] -= 0.5 * dx[axis];
-                shifted_patch_x_upper[axis] -= 0.5 * dx[axis];
-                patch->setPatchGeometry(new CartesianPatchGeometry<NDIM>(ratio_to_level_zero,
-                                                                         touches_regular_bdry,
-                                                                         touches_periodic_bdry,
-                                                                         dx,
-                                                                         shifted_patch_x_lower.data(),
-                                                                         shifted_patch_x_upper.data()));
+    // DOFs on this processor.
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int n_local_dofs = num_dofs_per_proc[mpi_rank];
 
-                // Set the boundary condition coefficients.
-                static const bool homogeneous_bc = true;
-                ExtendedRobinBcCoefStrategy* extended_bc_coef =
-                    dynamic_cast<ExtendedRobinBcCoefStrategy*>(u_bc_coefs[axis]);
-                if (extended_bc_coef)
-                {
-                    extended_bc_coef->clearTargetPatchDataIndex();
-                    extended_bc_coef->setHomogeneousBc(homogeneous_bc);
-                }
-                u_bc_coefs[axis]->setBcCoefs(
-                    acoef_data, bcoef_data, gcoef_data, NULL, *patch, trimmed_bdry_box, data_time);
-                if (gcoef_data && homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
+    const int first_local_dof = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+    const int last_local_dof = first_local_dof + n_local_dofs;
 
-                // Restore the original patch geometry object.
-                patch->setPatchGeometry(pgeom);
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Box<NDIM> side_patch_box[NDIM];
+        for (int axis = 0; axis < NDIM; ++axis)
+        {
+            side_patch_box[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+        }
 
-                // Modify the matrix coefficients to account for homogeneous
-                // boundary conditions.
-                for (Box<NDIM>::Iterator bc(bc_coef_box); bc; bc++)
-                {
-                    const Index<NDIM>& i = bc();
-                    const double& a = (*acoef_data)(i, 0);
-                    const double& b = (*bcoef_data)(i, 0);
-                    const bool velocity_bc = (a == 1.0 || MathUtilities<double>::equalEps(a, 1.0));
-                    const bool traction_bc = (b == 1.0 || MathUtilities<double>::equalEps(b, 1.0));
+        Pointer<SideData<NDIM, int> > u_dof_data = patch->getPatchData(u_dof_index_idx);
+        Pointer<CellData<NDIM, int> > p_dof_data = patch->getPatchData(p_dof_index_idx);
 #if !defined(NDEBUG)
-                    TBOX_ASSERT((velocity_bc || traction_bc) && !(velocity_bc && traction_bc));
+        const int u_data_depth = u_dof_data->getDepth();
+        const int p_data_depth = p_dof_data->getDepth();
+        TBOX_ASSERT(u_data_depth == 1);
+        TBOX_ASSERT(p_data_depth == 1);
 #endif
-                    Index<NDIM> i_intr = i;
-                    if (is_lower)
-                    {
-                        i_intr(bdry_normal_axis) += 0;
-                    }
-                    else
-                    {
-                        i_intr(bdry_normal_axis) -= 1;
-                    }
-                    const SideIndex<NDIM> i_s(i_intr, axis, SideIndex<NDIM>::Lower);
 
-                    if (velocity_bc)
-                    {
-                        if (is_lower)
-                        {
-                            uu_matrix_coefs(i_s, 0) -= uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1);
-                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1) = 0.0;
-                        }
-                        else
-                        {
-                            uu_matrix_coefs(i_s, 0) -= uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2);
-                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2) = 0.0;
-                        }
-                    }
-                    else if (traction_bc)
-                    {
-                        if (is_lower)
-                        {
-                            uu_matrix_coefs(i_s, 0) += uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1);
-                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1) = 0.0;
-                        }
-                        else
-                        {
-                            uu_matrix_coefs(i_s, 0) -= uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2);
-                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2) = 0.0;
-                        }
-                    }
-                    else
-                    {
-                        TBOX_ERROR(
-                            "StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(): Unknown BC type for "
-                            "tangential velocity specified.");
-                    }
+        // Get the local velocity DOFs.
+        for (int axis = 0; axis < NDIM; ++axis)
+        {
+            for (Box<NDIM>::Iterator b(side_patch_box[axis]); b; b++)
+            {
+                const CellIndex<NDIM>& i = b();
+                const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
+                const int dof_idx = (*u_dof_data)(i_s);
+                if (dof_idx >= first_local_dof && dof_idx < last_local_dof)
+                {
+                    is_field[0].insert(dof_idx);
                 }
             }
         }
 
-        // Modify matrix coefficients to account for physical boundary
-        // conditions along boundaries which ARE aligned with the data axis.
-        //
-        // NOTE: It important to set these values last to avoid problems at corners
-        // in the physical domain.  In particular, since Dirichlet boundary
-        // conditions for values located on the physical boundary override all other
-        // boundary conditions, we set those values last.
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        // Get the local pressure DOFs.
+        for (Box<NDIM>::Iterator b(patch_box); b; b++)
         {
-            for (int n = 0; n < n_physical_codim1_boxes; ++n)
+            const CellIndex<NDIM>& i = b();
+            const int dof_idx = (*p_dof_data)(i);
+            if (dof_idx >= first_local_dof && dof_idx < last_local_dof)
             {
-                const BoundaryBox<NDIM>& bdry_box = physical_codim1_boxes[n];
-                const unsigned int location_index = bdry_box.getLocationIndex();
-                const unsigned int bdry_normal_axis = location_index / 2;
-                const bool is_lower = location_index % 2 == 0;
-
-                if (bdry_normal_axis != axis) continue;
-
-                const Box<NDIM> bc_fill_box =
-                    pgeom->getBoundaryFillBox(bdry_box, patch_box, /* ghost_width_to_fill */ IntVector<NDIM>(1));
-                const BoundaryBox<NDIM> trimmed_bdry_box =
-                    PhysicalBoundaryUtilities::trimBoundaryCodim1Box(bdry_box, *patch);
-                const Box<NDIM> bc_coef_box = PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box);
+                is_field[1].insert(dof_idx);
+            }
+        }
+    }
 
-                Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-                Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-                Pointer<ArrayData<NDIM, double> > gcoef_data;
+    return;
+} // constructPatchLevelFields
 
-                // Set the boundary condition coefficients.
-                static const bool homogeneous_bc = true;
-                ExtendedRobinBcCoefStrategy* extended_bc_coef =
-                    dynamic_cast<ExtendedRobinBcCoefStrategy*>(u_bc_coefs[axis]);
-                if (extended_bc_coef)
-                {
-                    extended_bc_coef->clearTargetPatchDataIndex();
-                    extended_bc_coef->setHomogeneousBc(homogeneous_bc);
-                }
-                u_bc_coefs[axis]->setBcCoefs(
-                    acoef_data, bcoef_data, gcoef_data, NULL, *patch, trimmed_bdry_box, data_time);
-                if (gcoef_data && homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
+void
+StaggeredStokesPETScMatUtilities::constructProlongationOp(Mat& mat,
+                                                          const std::string& u_op_type,
+                                                          const std::string& p_op_type,
+                                                          int u_dof_index_idx,
+                                                          int p_dof_index_idx,
+                                                          const std::vector<int>& num_fine_dofs_per_proc,
+                                                          const std::vector<int>& num_coarse_dofs_per_proc,
+                                                          Pointer<PatchLevel<NDIM> > fine_patch_level,
+                                                          Pointer<PatchLevel<NDIM> > coarse_patch_level,
+                                                          const AO& coarse_level_ao,
+                                                          const int u_coarse_ao_offset,
+                                                          const int p_coarse_ao_offset)
+{
+    int ierr;
+    Mat p_prolong_mat = NULL;
+    PETScMatUtilities::constructProlongationOp(mat,
+                                               u_op_type,
+                                               u_dof_index_idx,
+                                               num_fine_dofs_per_proc,
+                                               num_coarse_dofs_per_proc,
+                                               fine_patch_level,
+                                               coarse_patch_level,
+                                               coarse_level_ao,
+                                               u_coarse_ao_offset);
 
-                // Modify the matrix coefficients to account for homogeneous
-                // boundary conditions.
-                for (Box<NDIM>::Iterator bc(bc_coef_box); bc; bc++)
+    PETScMatUtilities::constructProlongationOp(p_prolong_mat,
+                                               p_op_type,
+                                               p_dof_index_idx,
+                                               num_fine_dofs_per_proc,
+                                               num_coarse_dofs_per_proc,
+                                               fine_patch_level,
+                                               coarse_patch_level,
+                                               coarse_level_ao,
+                                               p_coarse_ao_offset);
+
+    // P{u,p} = (P_u + P_p){u,p}
+    ierr = MatAXPY(mat, 1.0, p_prolong_mat, DIFFERENT_NONZERO_PATTERN);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatDestroy(&p_prolong_mat);
+    IBTK_CHKERRQ(ierr);
+
+} // constructPatchLevelProlongationOp
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp_impl(
+    Mat& mat,
+    const bool reuse_nonzero_pattern,
+    const PoissonSpecifications& u_problem_coefs,
+    const std::vector<RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+    double data_time,
+    const std::vector<int>& num_dofs_per_proc,
+    int u_dof_index_idx,
+    int p_dof_index_idx,
+    Pointer<PatchLevel<NDIM> > patch_level)
+{
+    // Setup the finite difference stencils.
+    static const int uu_stencil_sz = 2 * NDIM + 1;
+    boost::array<Index<NDIM>, uu_stencil_sz> uu_stencil(array_constant<Index<NDIM>, uu_stencil_sz>(Index<NDIM>(0)));
+    for (unsigned int axis = 0, uu_stencil_index = 1; axis < NDIM; ++axis)
+    {
+        for (int side = 0; side <= 1; ++side, ++uu_stencil_index)
+        {
+            uu_stencil[uu_stencil_index](axis) = (side == 0 ? -1 : +1);
+        }
+    }
+    static const int up_stencil_sz = 2;
+    boost::array<boost::array<Index<NDIM>, up_stencil_sz>, NDIM> up_stencil(
+        array_constant<boost::array<Index<NDIM>, up_stencil_sz>, NDIM>(
+            array_constant<Index<NDIM>, up_stencil_sz>(Index<NDIM>(0))));
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        for (int side = 0; side <= 1; ++side)
+        {
+            up_stencil[axis][side](axis) = (side == 0 ? -1 : 0);
+        }
+    }
+    static const int pu_stencil_sz = 2 * NDIM;
+    boost::array<Index<NDIM>, pu_stencil_sz> pu_stencil(array_constant<Index<NDIM>, pu_stencil_sz>(Index<NDIM>(0)));
+    for (unsigned int axis = 0, pu_stencil_index = 0; axis < NDIM; ++axis)
+    {
+        for (int side = 0; side <= 1; ++side, ++pu_stencil_index)
+        {
+            pu_stencil[pu_stencil_index](axis) = (side == 0 ? 0 : +1);
+        }
+    }
+
+    // Determine the index ranges.
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int nlocal = num_dofs_per_proc[mpi_rank];
+    const int ilower = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+    const int iupper = ilower + nlocal;
+    const int ntotal = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
+
+    int ierr;
+    if (reuse_nonzero_pattern)
+    {
+        // The nonzero structure of the matrix is determined entirely by the
+        // DOF indices, so only the matrix values need to be recomputed.
+        ierr = MatZeroEntries(mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    else
+    {
+        // Determine the non-zero structure of the matrix.
+        std::vector<int> d_nnz(nlocal, 0), o_nnz(nlocal, 0);
+        for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<SideData<NDIM, int> > u_dof_index_data = patch->getPatchData(u_dof_index_idx);
+            Pointer<CellData<NDIM, int> > p_dof_index_data = patch->getPatchData(p_dof_index_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
                 {
-                    const Index<NDIM>& i = bc();
-                    const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
-                    const double& a = (*acoef_data)(i, 0);
-                    const double& b = (*bcoef_data)(i, 0);
-                    const bool velocity_bc = (a == 1.0 || MathUtilities<double>::equalEps(a, 1.0));
-                    const bool traction_bc = (b == 1.0 || MathUtilities<double>::equalEps(b, 1.0));
-#if !defined(NDEBUG)
-                    TBOX_ASSERT((velocity_bc || traction_bc) && !(velocity_bc && traction_bc));
-#endif
-                    if (velocity_bc)
+                    const CellIndex<NDIM>& ic = b();
+                    const SideIndex<NDIM> is(ic, axis, SideIndex<NDIM>::Lower);
+                    const int u_dof_index = (*u_dof_index_data)(is);
+                    if (UNLIKELY(ilower > u_dof_index || u_dof_index >= iupper)) continue;
+                    const int u_local_idx = u_dof_index - ilower;
+                    d_nnz[u_local_idx] += 1;
+                    for (unsigned int d = 0, uu_stencil_index = 1; d < NDIM; ++d)
                     {
-                        uu_matrix_coefs(i_s, 0) = 1.0;
-                        for (int k = 1; k < uu_stencil_sz; ++k)
-                        {
-                            uu_matrix_coefs(i_s, k) = 0.0;
-                        }
-                        for (int k = 0; k < up_stencil_sz; ++k)
+                        for (int side = 0; side <= 1; ++side, ++uu_stencil_index)
                         {
-                            up_matrix_coefs(i_s, k) = 0.0;
+                            const int uu_dof_index = (*u_dof_index_data)(is + uu_stencil[uu_stencil_index]);
+                            if (LIKELY(uu_dof_index >= ilower && uu_dof_index < iupper))
+                            {
+                                d_nnz[u_local_idx] += 1;
+                            }
+                            else
+                            {
+                                o_nnz[u_local_idx] += 1;
+                            }
                         }
                     }
-                    else if (traction_bc)
+                    for (int side = 0, up_stencil_index = 0; side <= 1; ++side, ++up_stencil_index)
                     {
-                        if (is_lower)
+                        const int up_dof_index = (*p_dof_index_data)(ic + up_stencil[axis][up_stencil_index]);
+                        if (LIKELY(up_dof_index >= ilower && up_dof_index < iupper))
                         {
-                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2) +=
-                                uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1);
-                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1) = 0.0;
+                            d_nnz[u_local_idx] += 1;
                         }
                         else
                         {
-                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1) +=
-                                uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2);
-                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2) = 0.0;
+                            o_nnz[u_local_idx] += 1;
                         }
                     }
-                    else
-                    {
-                        TBOX_ERROR(
-                            "StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(): Unknown BC type for "
-                            "normal velocity specified.");
-                    }
+                    d_nnz[u_local_idx] = std::min(nlocal, d_nnz[u_local_idx]);
+                    o_nnz[u_local_idx] = std::min(ntotal - nlocal, o_nnz[u_local_idx]);
                 }
             }
-        }
-
-        // Set matrix coefficients.
-        Pointer<SideData<NDIM, int> > u_dof_index_data = patch->getPatchData(u_dof_index_idx);
-        Pointer<CellData<NDIM, int> > p_dof_index_data = patch->getPatchData(p_dof_index_idx);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+            for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
             {
                 const CellIndex<NDIM>& ic = b();
-                const SideIndex<NDIM> is(ic, axis, SideIndex<NDIM>::Lower);
-                const int u_dof_index = (*u_dof_index_data)(is);
-                if (UNLIKELY(ilower > u_dof_index || u_dof_index >= iupper)) continue;
-
-                const int u_stencil_sz = uu_stencil_sz + up_stencil_sz;
-                std::vector<double> u_mat_vals(u_stencil_sz);
-                std::vector<int> u_mat_cols(u_stencil_sz);
-
-                u_mat_vals[0] = uu_matrix_coefs(is, 0);
-                u_mat_cols[0] = u_dof_index;
-                for (unsigned int d = 0, uu_stencil_index = 1; d < NDIM; ++d)
+                const int p_dof_index = (*p_dof_index_data)(ic);
+                if (UNLIKELY(ilower > p_dof_index || p_dof_index >= iupper)) continue;
+                const int p_local_idx = p_dof_index - ilower;
+                d_nnz[p_local_idx] += 1;
+                for (unsigned int axis = 0, pu_stencil_index = 0; axis < NDIM; ++axis)
                 {
-                    for (int side = 0; side <= 1; ++side, ++uu_stencil_index)
+                    for (int side = 0; side <= 1; ++side, ++pu_stencil_index)
                     {
-                        u_mat_vals[uu_stencil_index] = uu_matrix_coefs(is, uu_stencil_index);
-                        u_mat_cols[uu_stencil_index] = (*u_dof_index_data)(is + uu_stencil[uu_stencil_index]);
+                        const int pu_dof_index = (*u_dof_index_data)(
+                            SideIndex<NDIM>(ic + pu_stencil[pu_stencil_index], axis, SideIndex<NDIM>::Lower));
+                        if (LIKELY(pu_dof_index >= ilower && pu_dof_index < iupper))
+                        {
+                            d_nnz[p_local_idx] += 1;
+                        }
+                        else
+                        {
+                            o_nnz[p_local_idx] += 1;
+                        }
                     }
                 }
-                for (int side = 0, up_stencil_index = 0; side <= 1; ++side, ++up_stencil_index)
-                {
-                    u_mat_vals[uu_stencil_sz + side] = up_matrix_coefs(is, up_stencil_index);
-                    u_mat_cols[uu_stencil_sz + side] = (*p_dof_index_data)(ic + up_stencil[axis][up_stencil_index]);
-                }
-
-                ierr = MatSetValues(mat, 1, &u_dof_index, u_stencil_sz, &u_mat_cols[0], &u_mat_vals[0], INSERT_VALUES);
-                IBTK_CHKERRQ(ierr);
+                d_nnz[p_local_idx] = std::min(nlocal, d_nnz[p_local_idx]);
+                o_nnz[p_local_idx] = std::min(ntotal - nlocal, o_nnz[p_local_idx]);
             }
         }
 
-        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
-        {
-            const CellIndex<NDIM>& ic = b();
-            const int p_dof_index = (*p_dof_index_data)(ic);
-            if (UNLIKELY(ilower > p_dof_index || p_dof_index >= iupper)) continue;
+        // Create an empty matrix.
+        ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                            nlocal,
+                            nlocal,
+                            PETSC_DETERMINE,
+                            PETSC_DETERMINE,
+                            0,
+                            nlocal ? &d_nnz[0] : NULL,
+                            0,
+                            nlocal ? &o_nnz[0] : NULL,
+                            &mat);
+        IBTK_CHKERRQ(ierr);
 
-            const int p_stencil_sz = pu_stencil_sz + 1;
-            std::vector<double> p_mat_vals(p_stencil_sz);
-            std::vector<int> p_mat_cols(p_stencil_sz);
+        // Set some general matrix options.
+#if !defined(NDEBUG)
+        ierr = MatSetOption(mat, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatSetOption(mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+#endif
+    }
 
-            for (unsigned int axis = 0, pu_stencil_index = 0; axis < NDIM; ++axis)
+    // Set the matrix coefficients.
+    const double C = u_problem_coefs.getCConstant();
+    const double D = u_problem_coefs.getDConstant();
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        const double* const dx = pgeom->getDx();
+
+        const IntVector<NDIM> no_ghosts(0);
+        SideData<NDIM, double> uu_matrix_coefs(patch_box, uu_stencil_sz, no_ghosts);
+        SideData<NDIM, double> up_matrix_coefs(patch_box, up_stencil_sz, no_ghosts);
+        CellData<NDIM, double> pu_matrix_coefs(patch_box, pu_stencil_sz, no_ghosts);
+
+        // Compute all matrix coefficients, including those on the physical
+        // boundary; however, do not yet take physical boundary conditions into
+        // account.  Boundary conditions are handled subsequently.
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            std::vector<double> uu_mat_vals(uu_stencil_sz, 0.0);
+            uu_mat_vals[0] = C; // diagonal
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                for (int side = 0; side <= 1; ++side, ++pu_stencil_index)
-                {
-                    p_mat_vals[pu_stencil_index] = pu_matrix_coefs(ic, pu_stencil_index);
-                    p_mat_cols[pu_stencil_index] = (*u_dof_index_data)(
-                        SideIndex<NDIM>(ic + pu_stencil[pu_stencil_index], axis, SideIndex<NDIM>::Lower));
-                }
+                const double dx_sq = dx[d] * dx[d];
+                uu_mat_vals[0] -= 2 * D / dx_sq;    // diagonal
+                uu_mat_vals[2 * d + 1] = D / dx_sq; // lower off-diagonal
+                uu_mat_vals[2 * d + 2] = D / dx_sq; // upper off-diagonal
+            }
+            for (int uu_stencil_index = 0; uu_stencil_index < uu_stencil_sz; ++uu_stencil_index)
+            {
+                uu_matrix_coefs.fill(uu_mat_vals[uu_stencil_index], uu_stencil_index);
             }
-            p_mat_vals[pu_stencil_sz] = 0.0;
-            p_mat_cols[pu_stencil_sz] = p_dof_index;
 
-            ierr = MatSetValues(mat, 1, &p_dof_index, p_stencil_sz, &p_mat_cols[0], &p_mat_vals[0], INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
+            // grad p
+            for (int d = 0; d < NDIM; ++d)
+            {
+                up_matrix_coefs.getArrayData(d).fill(-1.0 / dx[d], 0);
+                up_matrix_coefs.getArrayData(d).fill(+1.0 / dx[d], 1);
+            }
+
+            // -div u
+            std::vector<double> pu_mat_vals(pu_stencil_sz, 0.0);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                pu_matrix_coefs.fill(+1.0 / dx[d], 2 * d);
+                pu_matrix_coefs.fill(-1.0 / dx[d], 2 * d + 1);
+            }
         }
-    }
 
-    // Assemble the matrix.
-    ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // constructPatchLevelMACStokesOp
+        // Data structures required to set physical boundary conditions.
+        const Array<BoundaryBox<NDIM> > physical_codim1_boxes =
+            PhysicalBoundaryUtilities::getPhysicalBoundaryCodim1Boxes(*patch);
+        const int n_physical_codim1_boxes = physical_codim1_boxes.size();
+        const double* const patch_x_lower = pgeom->getXLower();
+        const double* const patch_x_upper = pgeom->getXUpper();
+        const IntVector<NDIM>& ratio_to_level_zero = pgeom->getRatio();
+        Array<Array<bool> > touches_regular_bdry(NDIM), touches_periodic_bdry(NDIM);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            touches_regular_bdry[axis].resizeArray(2);
+            touches_periodic_bdry[axis].resizeArray(2);
+            for (int upperlower = 0; upperlower < 2; ++upperlower)
+            {
+                touches_regular_bdry[axis][upperlower] = pgeom->getTouchesRegularBoundary(axis, upperlower);
+                touches_periodic_bdry[axis][upperlower] = pgeom->getTouchesPeriodicBoundary(axis, upperlower);
+            }
+        }
 
-void
-StaggeredStokesPETScMatUtilities::constructPatchLevelASMSubdomains(std::vector<std::set<int> >& is_overlap,
-                                                                   std::vector<std::set<int> >& is_nonoverlap,
-                                                                   const IntVector<NDIM>& box_size,
-                                                                   const IntVector<NDIM>& overlap_size,
-                                                                   const std::vector<int>& /*num_dofs_per_proc*/,
-                                                                   int u_dof_index_idx,
-                                                                   int p_dof_index_idx,
-                                                                   Pointer<PatchLevel<NDIM> > patch_level,
-                                                                   Pointer<CoarseFineBoundary<NDIM> > /*cf_boundary*/)
-{
-    // Clear previously stored index sets.
-    for (unsigned int k = 0; k < is_overlap.size(); ++k)
-    {
-        is_overlap[k].clear();
-    }
-    is_overlap.clear();
-    for (unsigned int k = 0; k < is_nonoverlap.size(); ++k)
-    {
-        is_nonoverlap[k].clear();
-    }
-    is_nonoverlap.clear();
+        // Modify matrix coefficients to account for physical boundary
+        // conditions along boundaries which ARE NOT aligned with the data axis.
+        //
+        // NOTE: It important to set these values first to avoid problems at
+        // corners in the physical domain.  In particular, since Dirichlet
+        // boundary conditions for values located on the physical boundary
+        // override all other boundary conditions, we set those values last.
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (int n = 0; n < n_physical_codim1_boxes; ++n)
+            {
+                const BoundaryBox<NDIM>& bdry_box = physical_codim1_boxes[n];
+                const unsigned int location_index = bdry_box.getLocationIndex();
+                const unsigned int bdry_normal_axis = location_index / 2;
+                const bool is_lower = location_index % 2 == 0;
 
-    // Create variables to keep track of whether a particular velocity location
-    // is the "master" location.
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-    Pointer<SideVariable<NDIM, int> > patch_num_var = new SideVariable<NDIM, int>(
-        "StaggeredStokesPETScMatUtilities::constructPatchLevelASMSubdomains()::patch_num_var");
-    static const int patch_num_idx = var_db->registerPatchDataIndex(patch_num_var);
-    patch_level->allocatePatchData(patch_num_idx);
-    Pointer<SideVariable<NDIM, bool> > u_mastr_loc_var = new SideVariable<NDIM, bool>(
-        "StaggeredStokesPETScMatUtilities::constructPatchLevelASMSubdomains()::u_mastr_loc_var");
-    static const int u_mastr_loc_idx = var_db->registerPatchDataIndex(u_mastr_loc_var);
-    patch_level->allocatePatchData(u_mastr_loc_idx);
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
-    {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const int patch_num = patch->getPatchNumber();
-        Pointer<SideData<NDIM, int> > patch_num_data = patch->getPatchData(patch_num_idx);
-        Pointer<SideData<NDIM, bool> > u_mastr_loc_data = patch->getPatchData(u_mastr_loc_idx);
-        patch_num_data->fillAll(patch_num);
-        u_mastr_loc_data->fillAll(false);
-    }
+                if (bdry_normal_axis == axis) continue;
 
-    // Synchronize the patch number at patch boundaries to determine which patch
-    // owns a given DOF along patch boundaries.
-    RefineAlgorithm<NDIM> bdry_synch_alg;
-    bdry_synch_alg.registerRefine(patch_num_idx, patch_num_idx, patch_num_idx, NULL, new SideSynchCopyFillPattern());
-    bdry_synch_alg.createSchedule(patch_level)->fillData(0.0);
+                const Box<NDIM> bc_fill_box =
+                    pgeom->getBoundaryFillBox(bdry_box, patch_box, /* ghost_width_to_fill */ IntVector<NDIM>(1));
+                const BoundaryBox<NDIM> trimmed_bdry_box =
+                    PhysicalBoundaryUtilities::trimBoundaryCodim1Box(bdry_box, *patch);
+                const Box<NDIM> bc_coef_box = compute_tangential_extension(
+                    PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box), axis);
 
-    // For a single patch in a periodic domain, the far side DOFs are not master.
-    Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_level->getGridGeometry();
-    IntVector<NDIM> periodic_shift = grid_geom->getPeriodicShift(patch_level->getRatio());
-    const BoxArray<NDIM>& domain_boxes = patch_level->getPhysicalDomain();
-#if !defined(NDEBUG)
-    TBOX_ASSERT(domain_boxes.size() == 1);
-#endif
-    const Index<NDIM>& domain_upper = domain_boxes[0].upper();
+                Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+                Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+                Pointer<ArrayData<NDIM, double> > gcoef_data;
 
-    // Determine the number of local DOFs.
-    int local_dof_count = 0;
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
-    {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const int patch_num = patch->getPatchNumber();
-        const Box<NDIM>& patch_box = patch->getBox();
-        const IntVector<NDIM> patch_size = patch_box.numberCells();
+                // Temporarily reset the patch geometry object associated with
+                // the patch so that boundary conditions are set at the correct
+                // spatial locations.
+                boost::array<double, NDIM> shifted_patch_x_lower, shifted_patch_x_upper;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    shifted_patch_x_lower[d] = patch_x_lower[d];
+                    shifted_patch_x_upper[d] = patch_x_upper[d];
+                }
+                shifted_patch_x_lower[axis] -= 0.5 * dx[axis];
+                shifted_patch_x_upper[axis] -= 0.5 * dx[axis];
+                patch->setPatchGeometry(new CartesianPatchGeometry<NDIM>(ratio_to_level_zero,
+                                                                         touches_regular_bdry,
+                                                                         touches_periodic_bdry,
+                                                                         dx,
+                                                                         shifted_patch_x_lower.data(),
+                                                                         shifted_patch_x_upper.data()));
 
-        Pointer<SideData<NDIM, int> > u_dof_index_data = patch->getPatchData(u_dof_index_idx);
-        Pointer<SideData<NDIM, int> > patch_num_data = patch->getPatchData(patch_num_idx);
-        Pointer<SideData<NDIM, bool> > u_mastr_loc_data = patch->getPatchData(u_mastr_loc_idx);
-        for (unsigned int component_axis = 0; component_axis < NDIM; ++component_axis)
-        {
-            const int upper_domain_side_idx = domain_upper(component_axis) + 1;
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, component_axis)); b; b++)
-            {
-                const CellIndex<NDIM>& i = b();
-                const SideIndex<NDIM> is(i, component_axis, SideIndex<NDIM>::Lower);
-                bool fully_periodic_patch_in_axis =
-                    periodic_shift(component_axis) && (patch_size(component_axis) == periodic_shift(component_axis));
-                bool periodic_image = fully_periodic_patch_in_axis && (i(component_axis) == upper_domain_side_idx);
-                if ((*patch_num_data)(is) == patch_num && !periodic_image)
+                // Set the boundary condition coefficients.
+                static const bool homogeneous_bc = true;
+                ExtendedRobinBcCoefStrategy* extended_bc_coef =
+                    dynamic_cast<ExtendedRobinBcCoefStrategy*>(u_bc_coefs[axis]);
+                if (extended_bc_coef)
                 {
-                    (*u_mastr_loc_data)(is) = true;
-                    ++local_dof_count;
+                    extended_bc_coef->clearTargetPatchDataIndex();
+                    extended_bc_coef->setHomogeneousBc(homogeneous_bc);
                 }
-            }
-        }
-        local_dof_count += CellGeometry<NDIM>::toCellBox(patch_box).size();
-    }
+                u_bc_coefs[axis]->setBcCoefs(
+                    acoef_data, bcoef_data, gcoef_data, NULL, *patch, trimmed_bdry_box, data_time);
+                if (gcoef_data && homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
 
-    // Determine the subdomains associated with this processor.
-    const int n_local_patches = patch_level->getProcessorMapping().getNumberOfLocalIndices();
-    std::vector<std::vector<Box<NDIM> > > overlap_boxes(n_local_patches), nonoverlap_boxes(n_local_patches);
-    int patch_counter = 0, subdomain_counter = 0;
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++, ++patch_counter)
-    {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        IndexUtilities::partitionPatchBox(
-            overlap_boxes[patch_counter], nonoverlap_boxes[patch_counter], patch_box, box_size, overlap_size);
-        subdomain_counter += overlap_boxes[patch_counter].size();
-    }
-    is_overlap.resize(subdomain_counter);
-    is_nonoverlap.resize(subdomain_counter);
+                // Restore the original patch geometry object.
+                patch->setPatchGeometry(pgeom);
 
-    // Fill in the IS'es.
-    int nonoverlap_dof_counter = 0;
-    subdomain_counter = 0, patch_counter = 0;
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++, ++patch_counter)
-    {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        Box<NDIM> side_patch_box[NDIM];
-        for (int axis = 0; axis < NDIM; ++axis)
-        {
-            side_patch_box[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-        }
-        Pointer<SideData<NDIM, bool> > u_mastr_loc_data = patch->getPatchData(u_mastr_loc_idx);
-        Pointer<SideData<NDIM, int> > u_dof_data = patch->getPatchData(u_dof_index_idx);
-        const int u_data_depth = u_dof_data->getDepth();
-        Pointer<CellData<NDIM, int> > p_dof_data = patch->getPatchData(p_dof_index_idx);
-        const int p_data_depth = p_dof_data->getDepth();
+                // Modify the matrix coefficients to account for homogeneous
+                // boundary conditions.
+                for (Box<NDIM>::Iterator bc(bc_coef_box); bc; bc++)
+                {
+                    const Index<NDIM>& i = bc();
+                    const double& a = (*acoef_data)(i, 0);
+                    const double& b = (*bcoef_data)(i, 0);
+                    const bool velocity_bc = (a == 1.0 || MathUtilities<double>::equalEps(a, 1.0));
+                    const bool traction_bc = (b == 1.0 || MathUtilities<double>::equalEps(b, 1.0));
 #if !defined(NDEBUG)
-        TBOX_ASSERT(u_data_depth == 1);
-        TBOX_ASSERT(p_data_depth == 1);
-        TBOX_ASSERT(u_dof_data->getGhostCellWidth().min() >= overlap_size.max());
-        TBOX_ASSERT(p_dof_data->getGhostCellWidth().min() >= overlap_size.max());
+                    TBOX_ASSERT((velocity_bc || traction_bc) && !(velocity_bc && traction_bc));
 #endif
-        int n_patch_subdomains = static_cast<int>(nonoverlap_boxes[patch_counter].size());
-        for (int k = 0; k < n_patch_subdomains; ++k, ++subdomain_counter)
-        {
-            // The nonoverlapping subdomains.
-            const Box<NDIM>& sub_box = nonoverlap_boxes[patch_counter][k];
-            Box<NDIM> side_sub_box[NDIM];
-            for (int axis = 0; axis < NDIM; ++axis)
-            {
-                side_sub_box[axis] = SideGeometry<NDIM>::toSideBox(sub_box, axis);
-            }
-
-            // Get the local DOFs.
-            for (int axis = 0; axis < NDIM; ++axis)
-            {
-                for (Box<NDIM>::Iterator b(side_sub_box[axis]); b; b++)
-                {
-                    const SideIndex<NDIM> i_s(b(), axis, SideIndex<NDIM>::Lower);
-                    const bool at_upper_subdomain_bdry = (i_s(axis) == side_sub_box[axis].upper(axis));
-                    const bool at_upper_patch_bdry = (i_s(axis) == side_patch_box[axis].upper(axis));
-                    if (!at_upper_subdomain_bdry || (at_upper_patch_bdry && (*u_mastr_loc_data)(i_s)))
+                    Index<NDIM> i_intr = i;
+                    if (is_lower)
                     {
-                        const int dof_idx = (*u_dof_data)(i_s);
-                        if (dof_idx >= 0) is_nonoverlap[subdomain_counter].insert(dof_idx);
+                        i_intr(bdry_normal_axis) += 0;
                     }
-                }
-            }
-            for (Box<NDIM>::Iterator b(sub_box); b; b++)
-            {
-                const CellIndex<NDIM>& i = b();
-                const int dof_idx = (*p_dof_data)(i);
-                if (dof_idx >= 0) is_nonoverlap[subdomain_counter].insert(dof_idx);
-            }
-            const int n_nonoverlap = static_cast<int>(is_nonoverlap[subdomain_counter].size());
-            nonoverlap_dof_counter += n_nonoverlap;
-
-            // The overlapping subdomains.
-            const Box<NDIM>& overlap_sub_box = overlap_boxes[patch_counter][k];
-            Box<NDIM> side_overlap_sub_box[NDIM];
-            for (int axis = 0; axis < NDIM; ++axis)
-            {
-                side_overlap_sub_box[axis] = SideGeometry<NDIM>::toSideBox(overlap_sub_box, axis);
-            }
+                    else
+                    {
+                        i_intr(bdry_normal_axis) -= 1;
+                    }
+                    const SideIndex<NDIM> i_s(i_intr, axis, SideIndex<NDIM>::Lower);
 
-            // Get the overlap DOFs.
-            for (int axis = 0; axis < NDIM; ++axis)
-            {
-                for (Box<NDIM>::Iterator b(side_overlap_sub_box[axis]); b; b++)
-                {
-                    const SideIndex<NDIM> i_s(b(), axis, SideIndex<NDIM>::Lower);
-                    const int dof_idx = (*u_dof_data)(i_s);
-                    if (dof_idx >= 0) is_overlap[subdomain_counter].insert(dof_idx);
-                }
-            }
-            for (Box<NDIM>::Iterator b(overlap_sub_box); b; b++)
-            {
-                const CellIndex<NDIM>& i = b();
-                const int dof_idx = (*p_dof_data)(i);
-                if (dof_idx >= 0) is_overlap[subdomain_counter].insert(dof_idx);
+                    if (velocity_bc)
+                    {
+                        if (is_lower)
+                        {
+                            uu_matrix_coefs(i_s, 0) -= uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1);
+                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1) = 0.0;
+                        }
+                        else
+                        {
+                            uu_matrix_coefs(i_s, 0) -= uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2);
+                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2) = 0.0;
+                        }
+                    }
+                    else if (traction_bc)
+                    {
+                        if (is_lower)
+                        {
+                            uu_matrix_coefs(i_s, 0) += uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1);
+                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1) = 0.0;
+                        }
+                        else
+                        {
+                            uu_matrix_coefs(i_s, 0) -= uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2);
+                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2) = 0.0;
+                        }
+                    }
+                    else
+                    {
+                        TBOX_ERROR(
+                            "StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(): Unknown BC type for "
+                            "tangential velocity specified.");
+                    }
+                }
             }
         }
-    }
-#if !defined(NDEBUG)
-    TBOX_ASSERT(local_dof_count == nonoverlap_dof_counter);
-#endif
-
-    // Deallocate patch_num variable data.
-    patch_level->deallocatePatchData(patch_num_idx);
-    patch_level->deallocatePatchData(u_mastr_loc_idx);
-    return;
-} // constructPatchLevelASMSubdomains
-
-void
-StaggeredStokesPETScMatUtilities::constructPatchLevelFields(
-    std::vector<std::set<int> >& is_field,
-    std::vector<std::string>& is_field_name,
-    const std::vector<int>& num_dofs_per_proc,
-    int u_dof_index_idx,
-    int p_dof_index_idx,
-    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level)
-{
-    // Destroy the previously stored IS'es
-    for (unsigned int k = 0; k < is_field.size(); ++k)
-    {
-        is_field[k].clear();
-    }
-    is_field.clear();
-    is_field_name.clear();
 
-    // Resize vectors
-    is_field.resize(2);
-    is_field_name.resize(2);
+        // Modify matrix coefficients to account for physical boundary
+        // conditions along boundaries which ARE aligned with the data axis.
+        //
+        // NOTE: It important to set these values last to avoid problems at corners
+        // in the physical domain.  In particular, since Dirichlet boundary
+        // conditions for values located on the physical boundary override all other
+        // boundary conditions, we set those values last.
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (int n = 0; n < n_physical_codim1_boxes; ++n)
+            {
+                const BoundaryBox<NDIM>& bdry_box = physical_codim1_boxes[n];
+                const unsigned int location_index = bdry_box.getLocationIndex();
+                const unsigned int bdry_normal_axis = location_index / 2;
+                const bool is_lower = location_index % 2 == 0;
 
-    // Name of the fields.
-    static const int U_FIELD_IDX = 0;
-    static const int P_FIELD_IDX = 1;
-    is_field_name[U_FIELD_IDX] = "velocity";
-    is_field_name[P_FIELD_IDX] = "pressure";
+                if (bdry_normal_axis != axis) continue;
 
-    // DOFs on this processor.
-    const int mpi_rank = SAMRAI_MPI::getRank();
-    const int n_local_dofs = num_dofs_per_proc[mpi_rank];
+                const Box<NDIM> bc_fill_box =
+                    pgeom->getBoundaryFillBox(bdry_box, patch_box, /* ghost_width_to_fill */ IntVector<NDIM>(1));
+                const BoundaryBox<NDIM> trimmed_bdry_box =
+                    PhysicalBoundaryUtilities::trimBoundaryCodim1Box(bdry_box, *patch);
+                const Box<NDIM> bc_coef_box = PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box);
 
-    const int first_local_dof = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
-    const int last_local_dof = first_local_dof + n_local_dofs;
+                Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+                Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+                Pointer<ArrayData<NDIM, double> > gcoef_data;
 
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
-    {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        Box<NDIM> side_patch_box[NDIM];
-        for (int axis = 0; axis < NDIM; ++axis)
-        {
-            side_patch_box[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-        }
+                // Set the boundary condition coefficients.
+                static const bool homogeneous_bc = true;
+                ExtendedRobinBcCoefStrategy* extended_bc_coef =
+                    dynamic_cast<ExtendedRobinBcCoefStrategy*>(u_bc_coefs[axis]);
+                if (extended_bc_coef)
+                {
+                    extended_bc_coef->clearTargetPatchDataIndex();
+                    extended_bc_coef->setHomogeneousBc(homogeneous_bc);
+                }
+                u_bc_coefs[axis]->setBcCoefs(
+                    acoef_data, bcoef_data, gcoef_data, NULL, *patch, trimmed_bdry_box, data_time);
+                if (gcoef_data && homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
 
-        Pointer<SideData<NDIM, int> > u_dof_data = patch->getPatchData(u_dof_index_idx);
-        Pointer<CellData<NDIM, int> > p_dof_data = patch->getPatchData(p_dof_index_idx);
+                // Modify the matrix coefficients to account for homogeneous
+                // boundary conditions.
+                for (Box<NDIM>::Iterator bc(bc_coef_box); bc; bc++)
+                {
+                    const Index<NDIM>& i = bc();
+                    const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
+                    const double& a = (*acoef_data)(i, 0);
+                    const double& b = (*bcoef_data)(i, 0);
+                    const bool velocity_bc = (a == 1.0 || MathUtilities<double>::equalEps(a, 1.0));
+                    const bool traction_bc = (b == 1.0 || MathUtilities<double>::equalEps(b, 1.0));
 #if !defined(NDEBUG)
-        const int u_data_depth = u_dof_data->getDepth();
-        const int p_data_depth = p_dof_data->getDepth();
-        TBOX_ASSERT(u_data_depth == 1);
-        TBOX_ASSERT(p_data_depth == 1);
+                    TBOX_ASSERT((velocity_bc || traction_bc) && !(velocity_bc && traction_bc));
 #endif
+                    if (velocity_bc)
+                    {
+                        uu_matrix_coefs(i_s, 0) = 1.0;
+                        for (int k = 1; k < uu_stencil_sz; ++k)
+                        {
+                            uu_matrix_coefs(i_s, k) = 0.0;
+                        }
+                        for (int k = 0; k < up_stencil_sz; ++k)
+                        {
+                            up_matrix_coefs(i_s, k) = 0.0;
+                        }
+                    }
+                    else if (traction_bc)
+                    {
+                        if (is_lower)
+                        {
+                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2) +=
+                                uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1);
+                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1) = 0.0;
+                        }
+                        else
+                        {
+                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 1) +=
+                                uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2);
+                            uu_matrix_coefs(i_s, 2 * bdry_normal_axis + 2) = 0.0;
+                        }
+                    }
+                    else
+                    {
+                        TBOX_ERROR(
+                            "StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(): Unknown BC type for "
+                            "normal velocity specified.");
+                    }
+                }
+            }
+        }
 
-        // Get the local velocity DOFs.
-        for (int axis = 0; axis < NDIM; ++axis)
+        // Set matrix coefficients.
+        Pointer<SideData<NDIM, int> > u_dof_index_data = patch->getPatchData(u_dof_index_idx);
+        Pointer<CellData<NDIM, int> > p_dof_index_data = patch->getPatchData(p_dof_index_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (Box<NDIM>::Iterator b(side_patch_box[axis]); b; b++)
+            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
             {
-                const CellIndex<NDIM>& i = b();
-                const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
-                const int dof_idx = (*u_dof_data)(i_s);
-                if (dof_idx >= first_local_dof && dof_idx < last_local_dof)
+                const CellIndex<NDIM>& ic = b();
+                const SideIndex<NDIM> is(ic, axis, SideIndex<NDIM>::Lower);
+                const int u_dof_index = (*u_dof_index_data)(is);
+                if (UNLIKELY(ilower > u_dof_index || u_dof_index >= iupper)) continue;
+
+                const int u_stencil_sz = uu_stencil_sz + up_stencil_sz;
+                std::vector<double> u_mat_vals(u_stencil_sz);
+                std::vector<int> u_mat_cols(u_stencil_sz);
+
+                u_mat_vals[0] = uu_matrix_coefs(is, 0);
+                u_mat_cols[0] = u_dof_index;
+                for (unsigned int d = 0, uu_stencil_index = 1; d < NDIM; ++d)
                 {
-                    is_field[0].insert(dof_idx);
+                    for (int side = 0; side <= 1; ++side, ++uu_stencil_index)
+                    {
+                        u_mat_vals[uu_stencil_index] = uu_matrix_coefs(is, uu_stencil_index);
+                        u_mat_cols[uu_stencil_index] = (*u_dof_index_data)(is + uu_stencil[uu_stencil_index]);
+                    }
+                }
+                for (int side = 0, up_stencil_index = 0; side <= 1; ++side, ++up_stencil_index)
+                {
+                    u_mat_vals[uu_stencil_sz + side] = up_matrix_coefs(is, up_stencil_index);
+                    u_mat_cols[uu_stencil_sz + side] = (*p_dof_index_data)(ic + up_stencil[axis][up_stencil_index]);
                 }
+
+                ierr = MatSetValues(mat, 1, &u_dof_index, u_stencil_sz, &u_mat_cols[0], &u_mat_vals[0], INSERT_VALUES);
+                IBTK_CHKERRQ(ierr);
             }
         }
 
-        // Get the local pressure DOFs.
-        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
         {
-            const CellIndex<NDIM>& i = b();
-            const int dof_idx = (*p_dof_data)(i);
-            if (dof_idx >= first_local_dof && dof_idx < last_local_dof)
+            const CellIndex<NDIM>& ic = b();
+            const int p_dof_index = (*p_dof_index_data)(ic);
+            if (UNLIKELY(ilower > p_dof_index || p_dof_index >= iupper)) continue;
+
+            const int p_stencil_sz = pu_stencil_sz + 1;
+            std::vector<double> p_mat_vals(p_stencil_sz);
+            std::vector<int> p_mat_cols(p_stencil_sz);
+
+            for (unsigned int axis = 0, pu_stencil_index = 0; axis < NDIM; ++axis)
             {
-                is_field[1].insert(dof_idx);
+                for (int side = 0; side <= 1; ++side, ++pu_stencil_index)
+                {
+                    p_mat_vals[pu_stencil_index] = pu_matrix_coefs(ic, pu_stencil_index);
+                    p_mat_cols[pu_stencil_index] = (*u_dof_index_data)(
+                        SideIndex<NDIM>(ic + pu_stencil[pu_stencil_index], axis, SideIndex<NDIM>::Lower));
+                }
             }
+            p_mat_vals[pu_stencil_sz] = 0.0;
+            p_mat_cols[pu_stencil_sz] = p_dof_index;
+
+            ierr = MatSetValues(mat, 1, &p_dof_index, p_stencil_sz, &p_mat_cols[0], &p_mat_vals[0], INSERT_VALUES);
+            IBTK_CHKERRQ(ierr);
         }
     }
 
-    return;
-} // constructPatchLevelFields
-
-void
-StaggeredStokesPETScMatUtilities::constructProlongationOp(Mat& mat,
-                                                          const std::string& u_op_type,
-                                                          const std::string& p_op_type,
-                                                          int u_dof_index_idx,
-                                                          int p_dof_index_idx,
-                                                          const std::vector<int>& num_fine_dofs_per_proc,
-                                                          const std::vector<int>& num_coarse_dofs_per_proc,
-                                                          Pointer<PatchLevel<NDIM> > fine_patch_level,
-                                                          Pointer<PatchLevel<NDIM> > coarse_patch_level,
-                                                          const AO& coarse_level_ao,
-                                                          const int u_coarse_ao_offset,
-                                                          const int p_coarse_ao_offset)
-{
-    int ierr;
-    Mat p_prolong_mat = NULL;
-    PETScMatUtilities::constructProlongationOp(mat,
-                                               u_op_type,
-                                               u_dof_index_idx,
-                                               num_fine_dofs_per_proc,
-                                               num_coarse_dofs_per_proc,
-                                               fine_patch_level,
-                                               coarse_patch_level,
-                                               coarse_level_ao,
-                                               u_coarse_ao_offset);
-
-    PETScMatUtilities::constructProlongationOp(p_prolong_mat,
-                                               p_op_type,
-                                               p_dof_index_idx,
-                                               num_fine_dofs_per_proc,
-                                               num_coarse_dofs_per_proc,
-                                               fine_patch_level,
-                                               coarse_patch_level,
-                                               coarse_level_ao,
-                                               p_coarse_ao_offset);
-
-    // P{u,p} = (P_u + P_p){u,p}
-    ierr = MatAXPY(mat, 1.0, p_prolong_mat, DIFFERENT_NONZERO_PATTERN);
+    // Assemble the matrix.
+    ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);
     IBTK_CHKERRQ(ierr);
-    ierr = MatDestroy(&p_prolong_mat);
+    ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
     IBTK_CHKERRQ(ierr);
-
-} // constructPatchLevelProlongationOp
-
-/////////////////////////////// PROTECTED ////////////////////////////////////
-
-/////////////////////////////// PRIVATE //////////////////////////////////////
+    return;
+} // constructPatchLevelMACStokesOp_impl
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
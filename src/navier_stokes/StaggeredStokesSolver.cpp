@@ -102,6 +102,13 @@ StaggeredStokesSolver::setVelocityPoissonSpecifications(const PoissonSpecificati
     return;
 } // setVelocityPoissonSpecifications
 
+bool
+StaggeredStokesSolver::updateVelocityPoissonSpecifications(const PoissonSpecifications& U_problem_coefs)
+{
+    setVelocityPoissonSpecifications(U_problem_coefs);
+    return false;
+} // updateVelocityPoissonSpecifications
+
 void
 StaggeredStokesSolver::setComponentsHaveNullspace(const bool has_velocity_nullspace, const bool has_pressure_nullspace)
 {
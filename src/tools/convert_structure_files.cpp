@@ -0,0 +1,89 @@
+// Filename: convert_structure_files.cpp
+// Created on 17 Oct 2026
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic C++ objects
+#include <string>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/app_namespaces.h>
+
+/*******************************************************************************
+ * Convert the ASCII vertex and spring files of one or more structures to the  *
+ * binary formats read by IBStandardInitializer when the input database entry  *
+ * use_binary_structure_files is set to TRUE.                                  *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <structure base name> [<structure base name> ...]             *
+ *                                                                             *
+ * For each base name, the files <base name>.vertex and (if present)           *
+ * <base name>.spring are converted to <base name>.vertex.bin and              *
+ * <base name>.spring.bin.                                                     *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    if (argc < 2)
+    {
+        pout << "USAGE: " << argv[0] << " <structure base name> [<structure base name> ...]\n";
+    }
+    else if (SAMRAI_MPI::getRank() == 0)
+    {
+        for (int k = 1; k < argc; ++k)
+        {
+            const std::string base_filename = argv[k];
+            IBStandardInitializer::convertStructureFilesToBinary(base_filename);
+            pout << "converted structure files for " << base_filename << "\n";
+        }
+    }
+    SAMRAI_MPI::barrier();
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return argc < 2 ? 1 : 0;
+} // main
@@ -1,6 +1,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <time.h>
 #include <iosfwd>
@@ -10,6 +11,9 @@
 #include <set>
 #include <vector>
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "Index.h"
 #include "ibamr/RNG.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "mpi.h"
@@ -220,8 +224,68 @@ InvNormDist(double p)
 
     return x;
 }
+
+/*
+** Philox4x32-10 counter-based generator.
+**
+** Reference: J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw,
+** "Parallel Random Numbers: As Easy as 1, 2, 3", in Proceedings of the
+** International Conference for High Performance Computing, Networking,
+** Storage and Analysis (SC'11), 2011.
+*/
+static const uint32_t PHILOX_M0 = 0xD2511F53;
+static const uint32_t PHILOX_M1 = 0xCD9E8D57;
+static const uint32_t PHILOX_W0 = 0x9E3779B9;
+static const uint32_t PHILOX_W1 = 0xBB67AE85;
+static const int PHILOX_ROUNDS = 10;
+
+inline void
+philox4x32(uint32_t ctr[4], const uint32_t key_in[2])
+{
+    uint32_t key[2] = { key_in[0], key_in[1] };
+    for (int r = 0; r < PHILOX_ROUNDS; ++r)
+    {
+        const uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * static_cast<uint64_t>(ctr[0]);
+        const uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * static_cast<uint64_t>(ctr[2]);
+        const uint32_t hi0 = static_cast<uint32_t>(p0 >> 32), lo0 = static_cast<uint32_t>(p0);
+        const uint32_t hi1 = static_cast<uint32_t>(p1 >> 32), lo1 = static_cast<uint32_t>(p1);
+        ctr[0] = hi1 ^ ctr[1] ^ key[0];
+        ctr[1] = lo1;
+        ctr[2] = hi0 ^ ctr[3] ^ key[1];
+        ctr[3] = lo0;
+        key[0] += PHILOX_W0;
+        key[1] += PHILOX_W1;
+    }
+    return;
+} // philox4x32
+
+// Convert a pair of 32-bit words to a double with 53 random bits that is
+// uniformly distributed on the open interval (0,1).
+inline double
+uniform53(const uint32_t a, const uint32_t b)
+{
+    return (static_cast<double>(a >> 5) * 67108864.0 + static_cast<double>(b >> 6) + 0.5) *
+           (1.0 / 9007199254740992.0);
+} // uniform53
+
+// Generate a pair of independent standard normal values from the output of
+// one Philox call via the Box-Muller transform.
+inline void
+philox_normal_pair(const uint32_t ctr_in[4], const uint32_t key[2], double& z0, double& z1)
+{
+    static const double TWO_PI = 6.283185307179586476925286766559;
+    uint32_t ctr[4] = { ctr_in[0], ctr_in[1], ctr_in[2], ctr_in[3] };
+    philox4x32(ctr, key);
+    const double r = sqrt(-2.0 * log(uniform53(ctr[0], ctr[1])));
+    const double theta = TWO_PI * uniform53(ctr[2], ctr[3]);
+    z0 = r * cos(theta);
+    z1 = r * sin(theta);
+    return;
+} // philox_normal_pair
 }
 
+unsigned int RNG::s_counter_seed = 4357;
+
 void
 RNG::genrandn(double* result)
 {
@@ -238,6 +302,59 @@ RNG::genrandn(double* result)
     return;
 } // genrandn
 
+void
+RNG::genrandn(ArrayData<NDIM, double>& data,
+              const Box<NDIM>& box,
+              const int step_num,
+              const int level_num,
+              const int stream_num)
+{
+    const int depth = data.getDepth();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(data.getBox().contains(box));
+    TBOX_ASSERT(0 <= level_num && level_num < 256);
+    TBOX_ASSERT(0 <= stream_num && stream_num < 65536);
+    TBOX_ASSERT(depth <= 256);
+#endif
+    if (box.empty()) return;
+
+    // The key is determined by the global seed and the time step number.  The
+    // counter is determined by the global cell index, the level number, the
+    // stream number, and the depth.  Each call to the generator yields values
+    // for a pair of consecutive depths, so that the generated values do not
+    // depend on the order in which they are computed.
+    const uint32_t key[2] = { s_counter_seed, static_cast<uint32_t>(step_num) };
+    const uint32_t tag = (static_cast<uint32_t>(level_num) << 24) | (static_cast<uint32_t>(stream_num) << 8);
+    const int slab_lower = box.lower(NDIM - 1);
+    const int slab_upper = box.upper(NDIM - 1);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int slab = slab_lower; slab <= slab_upper; ++slab)
+    {
+        Box<NDIM> slab_box = box;
+        slab_box.lower(NDIM - 1) = slab;
+        slab_box.upper(NDIM - 1) = slab;
+        for (Box<NDIM>::Iterator b(slab_box); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            uint32_t ctr[4] = { static_cast<uint32_t>(i(0)), static_cast<uint32_t>(i(1)), 0, tag };
+#if (NDIM == 3)
+            ctr[2] = static_cast<uint32_t>(i(2));
+#endif
+            for (int d = 0; d < depth; d += 2)
+            {
+                ctr[3] = tag | static_cast<uint32_t>(d / 2);
+                double z0, z1;
+                philox_normal_pair(ctr, key, z0, z1);
+                data(i, d) = z0;
+                if (d + 1 < depth) data(i, d + 1) = z1;
+            }
+        }
+    }
+    return;
+} // genrandn
+
 void
 RNG::parallel_seed(int global_seed)
 {
@@ -262,6 +379,13 @@ RNG::parallel_seed(int global_seed)
         std::cout << "\nGlobal seed = " << seed << "\n\n";
     }
 
+    // All processes share the global seed of the counter-based generator.
+    if (size > 1)
+    {
+        MPI_Bcast(&seed, 1, MPI_INT, mpi_root, MPI_COMM_WORLD);
+    }
+    s_counter_seed = static_cast<unsigned int>(seed);
+
     if (size > 1)
     {
         // This is based on Mike Lijewski's code in LLNS/main.cpp
@@ -0,0 +1,251 @@
+// Filename: main.cpp
+// Created on 17 Oct 2026
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic C++ objects
+#include <string>
+#include <vector>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBSpringForceSpec.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LNode.h>
+#include <ibtk/LNodeSetData.h>
+#include <ibtk/LNodeSetVariable.h>
+
+// Local helper functions.
+namespace
+{
+// Initialize the Lagrangian data on level 0 of the patch hierarchy using the
+// specified initializer.
+Pointer<LData>
+initialize_level_data(Pointer<IBStandardInitializer> initializer,
+                      const int lag_node_index_idx,
+                      Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                      const std::string& name)
+{
+    const int level_number = 0;
+    initializer->computeGlobalNodeCountOnPatchLevel(patch_hierarchy, level_number, 0.0, false, true);
+    const unsigned int num_local_nodes =
+        initializer->computeLocalNodeCountOnPatchLevel(patch_hierarchy, level_number, 0.0, false, true);
+    Pointer<LData> X_data = new LData(name + "::X", num_local_nodes, NDIM);
+    Pointer<LData> U_data = new LData(name + "::U", num_local_nodes, NDIM);
+    initializer->initializeDataOnPatchLevel(
+        lag_node_index_idx, 0, 0, X_data, U_data, patch_hierarchy, level_number, 0.0, false, true, NULL);
+    return X_data;
+} // initialize_level_data
+
+// Determine whether two nodes have identical spring specifications.
+bool
+springs_match(const LNode& node0, const LNode& node1)
+{
+    const IBSpringForceSpec* const spec0 = node0.getNodeDataItem<IBSpringForceSpec>();
+    const IBSpringForceSpec* const spec1 = node1.getNodeDataItem<IBSpringForceSpec>();
+    if (!spec0 || !spec1) return !spec0 && !spec1;
+    return spec0->getMasterNodeIndex() == spec1->getMasterNodeIndex() &&
+           spec0->getSlaveNodeIndices() == spec1->getSlaveNodeIndices() &&
+           spec0->getForceFunctionIndices() == spec1->getForceFunctionIndices() &&
+           spec0->getParameters() == spec1->getParameters();
+} // springs_match
+}
+
+/*******************************************************************************
+ * This test converts the ASCII vertex and spring files of the structures      *
+ * listed in the IBStandardInitializer input database to the binary formats,   *
+ * and then checks that IBStandardInitializer initializes exactly the same     *
+ * Lagrangian data from the ASCII and binary files.  One of the structures     *
+ * has no springs.                                                             *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool test_passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "binary_structure_files.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Convert the ASCII structure files to the binary formats.
+        Pointer<Database> initializer_db = app_initializer->getComponentDatabase("IBStandardInitializer");
+        const Array<std::string> structure_names = initializer_db->getStringArray("structure_names");
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            for (int k = 0; k < structure_names.size(); ++k)
+            {
+                IBStandardInitializer::convertStructureFilesToBinary(structure_names[k]);
+            }
+        }
+        SAMRAI_MPI::barrier();
+
+        // Create initializers that read the ASCII and binary files.
+        initializer_db->putBool("use_binary_structure_files", false);
+        Pointer<IBStandardInitializer> ascii_initializer =
+            new IBStandardInitializer("ASCIIStandardInitializer", initializer_db);
+        initializer_db->putBool("use_binary_structure_files", true);
+        Pointer<IBStandardInitializer> binary_initializer =
+            new IBStandardInitializer("BinaryStandardInitializer", initializer_db);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<LNodeSetVariable> lag_node_index_var = new LNodeSetVariable("lag_node_index");
+        const int ascii_idx =
+            var_db->registerVariableAndContext(lag_node_index_var, var_db->getContext("ascii"), IntVector<NDIM>(0));
+        const int binary_idx =
+            var_db->registerVariableAndContext(lag_node_index_var, var_db->getContext("binary"), IntVector<NDIM>(0));
+
+        // Initialize the patch hierarchy and the Lagrangian data.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(ascii_idx, 0.0);
+        level->allocatePatchData(binary_idx, 0.0);
+        Pointer<LData> X_ascii_data = initialize_level_data(ascii_initializer, ascii_idx, patch_hierarchy, "ascii");
+        Pointer<LData> X_binary_data =
+            initialize_level_data(binary_initializer, binary_idx, patch_hierarchy, "binary");
+
+        // Compare the vertex positions.
+        int num_errors = 0;
+        const unsigned int num_local_nodes = X_ascii_data->getLocalNodeCount();
+        if (X_binary_data->getLocalNodeCount() != num_local_nodes)
+        {
+            ++num_errors;
+        }
+        else
+        {
+            const double* const X_ascii = X_ascii_data->getLocalFormVecArray()->data();
+            const double* const X_binary = X_binary_data->getLocalFormVecArray()->data();
+            for (unsigned int k = 0; k < NDIM * num_local_nodes; ++k)
+            {
+                if (X_ascii[k] != X_binary[k]) ++num_errors;
+            }
+            X_ascii_data->restoreArrays();
+            X_binary_data->restoreArrays();
+        }
+
+        // Compare the node indexing and the spring specifications.
+        int num_springs = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> ascii_idx_data = patch->getPatchData(ascii_idx);
+            Pointer<LNodeSetData> binary_idx_data = patch->getPatchData(binary_idx);
+            int num_ascii_sets = 0, num_binary_sets = 0;
+            for (LNodeSetData::SetIterator it(*binary_idx_data); it; it++) ++num_binary_sets;
+            for (LNodeSetData::SetIterator it(*ascii_idx_data); it; it++)
+            {
+                ++num_ascii_sets;
+                const LNodeSet& ascii_node_set = *it;
+                const LNodeSet* const binary_node_set = binary_idx_data->getItem(it.getIndex());
+                if (!binary_node_set || binary_node_set->size() != ascii_node_set.size())
+                {
+                    ++num_errors;
+                    continue;
+                }
+                for (unsigned int n = 0; n < ascii_node_set.size(); ++n)
+                {
+                    const LNode& ascii_node = *ascii_node_set[n];
+                    const LNode& binary_node = *(*binary_node_set)[n];
+                    if (ascii_node.getLagrangianIndex() != binary_node.getLagrangianIndex() ||
+                        ascii_node.getLocalPETScIndex() != binary_node.getLocalPETScIndex() ||
+                        !springs_match(ascii_node, binary_node))
+                    {
+                        ++num_errors;
+                    }
+                    const IBSpringForceSpec* const spec = ascii_node.getNodeDataItem<IBSpringForceSpec>();
+                    if (spec) num_springs += static_cast<int>(spec->getNumberOfSprings());
+                }
+            }
+            if (num_ascii_sets != num_binary_sets) ++num_errors;
+        }
+        num_errors = SAMRAI_MPI::sumReduction(num_errors);
+        num_springs = SAMRAI_MPI::sumReduction(num_springs);
+
+        // Every spring in the input files must have been read.
+        const int expected_num_springs = input_db->getInteger("NUM_SPRINGS");
+        pout << "number of springs read: " << num_springs << " (expected " << expected_num_springs << ")\n";
+        pout << "number of mismatched entries: " << num_errors << "\n";
+        test_passed = num_errors == 0 && num_springs == expected_num_springs;
+        pout << (test_passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main
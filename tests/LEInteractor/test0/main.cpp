@@ -0,0 +1,387 @@
+// Filename: main.cpp
+// Created on 17 Oct 2026
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/app_namespaces.h>
+
+// Local helper functions.
+namespace
+{
+inline double
+random_value()
+{
+    return static_cast<double>(rand()) / static_cast<double>(RAND_MAX);
+} // random_value
+
+void
+fill_random(Pointer<CellData<NDIM, double> > q_data)
+{
+    for (int d = 0; d < q_data->getDepth(); ++d)
+    {
+        for (Box<NDIM>::Iterator b(q_data->getGhostBox()); b; b++)
+        {
+            (*q_data)(CellIndex<NDIM>(b()), d) = random_value();
+        }
+    }
+    return;
+} // fill_random
+
+void
+fill_random(Pointer<SideData<NDIM, double> > q_data)
+{
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        for (int d = 0; d < q_data->getDepth(); ++d)
+        {
+            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(q_data->getGhostBox(), axis)); b; b++)
+            {
+                (*q_data)(SideIndex<NDIM>(b(), axis, SideIndex<NDIM>::Lower), d) = random_value();
+            }
+        }
+    }
+    return;
+} // fill_random
+
+double
+max_abs(const std::vector<double>& a)
+{
+    double max_val = 0.0;
+    for (unsigned int k = 0; k < a.size(); ++k) max_val = std::max(max_val, std::abs(a[k]));
+    return max_val;
+} // max_abs
+
+double
+max_abs_diff(const std::vector<double>& a, const std::vector<double>& b)
+{
+    double max_val = 0.0;
+    for (unsigned int k = 0; k < a.size(); ++k) max_val = std::max(max_val, std::abs(a[k] - b[k]));
+    return max_val;
+} // max_abs_diff
+
+inline double
+relative_diff(const double diff, const double norm)
+{
+    return norm > 0.0 ? diff / norm : diff;
+} // relative_diff
+
+double
+max_abs(Pointer<CellData<NDIM, double> > q_data)
+{
+    return q_data->getArrayData().maxNorm(q_data->getGhostBox());
+} // max_abs
+
+double
+max_abs(Pointer<SideData<NDIM, double> > q_data)
+{
+    double max_val = 0.0;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        max_val = std::max(max_val,
+                           q_data->getArrayData(axis).maxNorm(
+                               SideGeometry<NDIM>::toSideBox(q_data->getGhostBox(), axis)));
+    }
+    return max_val;
+} // max_abs
+}
+
+/*******************************************************************************
+ * This test compares the cell-sorted interaction kernels of LEInteractor to   *
+ * the default kernels for the IB_4, IB_4_W8, BSPLINE_4, and BSPLINE_6 kernel  *
+ * functions, for both cell-centered and side-centered data.  Interpolated     *
+ * values must agree to roundoff, as must spread values.                       *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool test_passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "le_interactor.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.  The
+        // ghost cell width must accommodate the widest kernel that is tested.
+        std::vector<std::string> kernel_fcns;
+        kernel_fcns.push_back("IB_4");
+        kernel_fcns.push_back("IB_4_W8");
+        kernel_fcns.push_back("BSPLINE_4");
+        kernel_fcns.push_back("BSPLINE_6");
+        int gcw = 0;
+        for (unsigned int k = 0; k < kernel_fcns.size(); ++k)
+        {
+            TBOX_ASSERT(LEInteractor::hasCellSortedKernel(kernel_fcns[k]));
+            gcw = std::max(gcw, LEInteractor::getMinimumGhostWidth(kernel_fcns[k]));
+        }
+
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        const int depth = input_db->getIntegerWithDefault("DEPTH", 2);
+        Pointer<CellVariable<NDIM, double> > q_cc_var = new CellVariable<NDIM, double>("q_cc", depth);
+        Pointer<CellVariable<NDIM, double> > r_cc_var = new CellVariable<NDIM, double>("r_cc", depth);
+        Pointer<SideVariable<NDIM, double> > q_sc_var = new SideVariable<NDIM, double>("q_sc", depth);
+        Pointer<SideVariable<NDIM, double> > r_sc_var = new SideVariable<NDIM, double>("r_sc", depth);
+        const int q_cc_idx = var_db->registerVariableAndContext(q_cc_var, ctx, IntVector<NDIM>(gcw));
+        const int r_cc_idx = var_db->registerVariableAndContext(r_cc_var, ctx, IntVector<NDIM>(gcw));
+        const int q_sc_idx = var_db->registerVariableAndContext(q_sc_var, ctx, IntVector<NDIM>(gcw));
+        const int r_sc_idx = var_db->registerVariableAndContext(r_sc_var, ctx, IntVector<NDIM>(gcw));
+
+        // Initialize the patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(q_cc_idx, 0.0);
+        level->allocatePatchData(r_cc_idx, 0.0);
+        level->allocatePatchData(q_sc_idx, 0.0);
+        level->allocatePatchData(r_sc_idx, 0.0);
+
+        // Generate the same random marker positions and values on all
+        // processors.
+        const int num_markers = input_db->getIntegerWithDefault("NUM_MARKERS", 1000);
+        const double tol = input_db->getDoubleWithDefault("TOL", 1.0e-12);
+        srand(input_db->getIntegerWithDefault("SEED", 0));
+        const double* const domain_x_lower = grid_geometry->getXLower();
+        const double* const domain_x_upper = grid_geometry->getXUpper();
+        std::vector<double> X(NDIM * num_markers), F(depth * num_markers);
+        for (int k = 0; k < num_markers; ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X[NDIM * k + d] = domain_x_lower[d] + random_value() * (domain_x_upper[d] - domain_x_lower[d]);
+            }
+            for (int d = 0; d < depth; ++d)
+            {
+                F[depth * k + d] = random_value() - 0.5;
+            }
+        }
+
+        for (unsigned int k = 0; k < kernel_fcns.size(); ++k)
+        {
+            const std::string& kernel_fcn = kernel_fcns[k];
+            double interp_cc_err = 0.0, interp_sc_err = 0.0, spread_cc_err = 0.0, spread_sc_err = 0.0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                Pointer<CellData<NDIM, double> > q_cc_data = patch->getPatchData(q_cc_idx);
+                Pointer<CellData<NDIM, double> > r_cc_data = patch->getPatchData(r_cc_idx);
+                Pointer<SideData<NDIM, double> > q_sc_data = patch->getPatchData(q_sc_idx);
+                Pointer<SideData<NDIM, double> > r_sc_data = patch->getPatchData(r_sc_idx);
+
+                // Interpolate random Eulerian data using both implementations.
+                fill_random(q_cc_data);
+                fill_random(q_sc_data);
+                std::vector<double> Q_default(depth * num_markers, 0.0), Q_sorted(depth * num_markers, 0.0);
+                LEInteractor::interpolate(&Q_default[0],
+                                          depth,
+                                          &X[0],
+                                          NDIM,
+                                          q_cc_data,
+                                          patch,
+                                          patch_box,
+                                          kernel_fcn,
+                                          /*use_cell_sorted_kernels*/ false);
+                LEInteractor::interpolate(&Q_sorted[0],
+                                          depth,
+                                          &X[0],
+                                          NDIM,
+                                          q_cc_data,
+                                          patch,
+                                          patch_box,
+                                          kernel_fcn,
+                                          /*use_cell_sorted_kernels*/ true);
+                interp_cc_err =
+                    std::max(interp_cc_err, relative_diff(max_abs_diff(Q_default, Q_sorted), max_abs(Q_default)));
+
+                std::fill(Q_default.begin(), Q_default.end(), 0.0);
+                std::fill(Q_sorted.begin(), Q_sorted.end(), 0.0);
+                LEInteractor::interpolate(&Q_default[0],
+                                          depth,
+                                          &X[0],
+                                          NDIM,
+                                          q_sc_data,
+                                          patch,
+                                          patch_box,
+                                          kernel_fcn,
+                                          /*use_cell_sorted_kernels*/ false);
+                LEInteractor::interpolate(&Q_sorted[0],
+                                          depth,
+                                          &X[0],
+                                          NDIM,
+                                          q_sc_data,
+                                          patch,
+                                          patch_box,
+                                          kernel_fcn,
+                                          /*use_cell_sorted_kernels*/ true);
+                interp_sc_err =
+                    std::max(interp_sc_err, relative_diff(max_abs_diff(Q_default, Q_sorted), max_abs(Q_default)));
+
+                // Spread the random Lagrangian data using both implementations.
+                q_cc_data->fillAll(0.0);
+                r_cc_data->fillAll(0.0);
+                LEInteractor::spread(q_cc_data,
+                                     &F[0],
+                                     depth,
+                                     &X[0],
+                                     NDIM,
+                                     patch,
+                                     patch_box,
+                                     kernel_fcn,
+                                     /*use_threaded_spreading*/ false,
+                                     /*use_cell_sorted_kernels*/ false);
+                LEInteractor::spread(r_cc_data,
+                                     &F[0],
+                                     depth,
+                                     &X[0],
+                                     NDIM,
+                                     patch,
+                                     patch_box,
+                                     kernel_fcn,
+                                     /*use_threaded_spreading*/ false,
+                                     /*use_cell_sorted_kernels*/ true);
+                const double q_cc_norm = max_abs(q_cc_data);
+                r_cc_data->getArrayData().subtract(
+                    r_cc_data->getArrayData(), q_cc_data->getArrayData(), r_cc_data->getGhostBox());
+                spread_cc_err = std::max(spread_cc_err, relative_diff(max_abs(r_cc_data), q_cc_norm));
+
+                q_sc_data->fillAll(0.0);
+                r_sc_data->fillAll(0.0);
+                LEInteractor::spread(q_sc_data,
+                                     &F[0],
+                                     depth,
+                                     &X[0],
+                                     NDIM,
+                                     patch,
+                                     patch_box,
+                                     kernel_fcn,
+                                     /*use_threaded_spreading*/ false,
+                                     /*use_cell_sorted_kernels*/ false);
+                LEInteractor::spread(r_sc_data,
+                                     &F[0],
+                                     depth,
+                                     &X[0],
+                                     NDIM,
+                                     patch,
+                                     patch_box,
+                                     kernel_fcn,
+                                     /*use_threaded_spreading*/ false,
+                                     /*use_cell_sorted_kernels*/ true);
+                const double q_sc_norm = max_abs(q_sc_data);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    r_sc_data->getArrayData(axis).subtract(
+                        r_sc_data->getArrayData(axis),
+                        q_sc_data->getArrayData(axis),
+                        SideGeometry<NDIM>::toSideBox(r_sc_data->getGhostBox(), axis));
+                }
+                spread_sc_err = std::max(spread_sc_err, relative_diff(max_abs(r_sc_data), q_sc_norm));
+            }
+            interp_cc_err = SAMRAI_MPI::maxReduction(interp_cc_err);
+            interp_sc_err = SAMRAI_MPI::maxReduction(interp_sc_err);
+            spread_cc_err = SAMRAI_MPI::maxReduction(spread_cc_err);
+            spread_sc_err = SAMRAI_MPI::maxReduction(spread_sc_err);
+            pout << kernel_fcn << ":\n"
+                 << "  cell-centered interpolation relative difference: " << interp_cc_err << "\n"
+                 << "  side-centered interpolation relative difference: " << interp_sc_err << "\n"
+                 << "  cell-centered spreading relative difference:     " << spread_cc_err << "\n"
+                 << "  side-centered spreading relative difference:     " << spread_sc_err << "\n";
+            if (!(interp_cc_err <= tol && interp_sc_err <= tol && spread_cc_err <= tol && spread_sc_err <= tol))
+            {
+                test_passed = false;
+            }
+        }
+
+        pout << (test_passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main
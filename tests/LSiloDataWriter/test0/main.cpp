@@ -0,0 +1,239 @@
+// Filename: main.cpp
+// Created on 17 Oct 2026
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscao.h>
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LSiloDataWriter.h>
+#include <ibtk/app_namespaces.h>
+
+#if defined(IBTK_HAVE_SILO)
+#include <silo.h>
+
+// Local helper functions.
+namespace
+{
+// The position of the marker with the specified Lagrangian index.  The values
+// are exactly representable in single precision, which is the precision used
+// by LSiloDataWriter to write marker clouds.
+double
+marker_posn(const int lag_idx, const int d)
+{
+    return d == 0 ? static_cast<double>(lag_idx) / 64.0 : 1.0 - static_cast<double>(lag_idx) / 128.0;
+} // marker_posn
+}
+#endif
+
+/*******************************************************************************
+ * This test writes a marker cloud from each MPI process with LSiloDataWriter, *
+ * using the number of MPI processes per Silo file specified by the            *
+ * silo_number_procs_per_file key in the Main input database, and then reads   *
+ * the processor files back and checks that every marker was written to the    *
+ * correct file and directory with the correct position.                       *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool test_passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "silo_data_writer.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+#if defined(IBTK_HAVE_SILO)
+        Pointer<Database> main_db = app_initializer->getComponentDatabase("Main");
+        const int mpi_rank = SAMRAI_MPI::getRank();
+        const int mpi_nodes = SAMRAI_MPI::getNodes();
+        const int num_markers = input_db->getInteger("NUM_MARKERS");
+        const int num_total_markers = mpi_nodes * num_markers;
+
+        // The data writer must be configured from the Main input database.
+        Pointer<LSiloDataWriter> silo_data_writer = app_initializer->getLSiloDataWriter();
+        const int num_procs_per_file = main_db->getInteger("silo_number_procs_per_file");
+        int num_errors = 0;
+        if (silo_data_writer->getNumberOfProcessesPerFile() != num_procs_per_file) ++num_errors;
+
+        // Each MPI process registers a marker cloud consisting of a contiguous
+        // range of Lagrangian indices.  The Lagrangian indices are mapped to
+        // PETSc indices in reverse order, so that the data of each marker cloud
+        // is owned by a different MPI process than the one that writes it.
+        std::vector<int> lag_idxs(num_markers), petsc_idxs(num_markers);
+        for (int k = 0; k < num_markers; ++k)
+        {
+            petsc_idxs[k] = mpi_rank * num_markers + k;
+            lag_idxs[k] = num_total_markers - 1 - petsc_idxs[k];
+        }
+        AO ao;
+        int ierr = AOCreateBasic(PETSC_COMM_WORLD, num_markers, &lag_idxs[0], &petsc_idxs[0], &ao);
+        IBTK_CHKERRQ(ierr);
+
+        Pointer<LData> X_data = new LData("X", num_markers, NDIM);
+        Vec X_vec = X_data->getVec();
+        for (int k = 0; k < num_markers; ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                ierr = VecSetValue(X_vec, NDIM * petsc_idxs[k] + d, marker_posn(lag_idxs[k], d), INSERT_VALUES);
+                IBTK_CHKERRQ(ierr);
+            }
+        }
+        ierr = VecAssemblyBegin(X_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAssemblyEnd(X_vec);
+        IBTK_CHKERRQ(ierr);
+
+        std::ostringstream cloud_name;
+        cloud_name << "cloud_" << mpi_rank;
+        silo_data_writer->registerMarkerCloud(cloud_name.str(), num_markers, mpi_rank * num_markers, 0);
+        silo_data_writer->registerCoordsData(X_data, 0);
+        silo_data_writer->registerLagrangianAO(ao, 0);
+        silo_data_writer->writePlotData(0, 0.0);
+        SAMRAI_MPI::barrier();
+
+        // Read the processor files back and check the marker clouds.
+        if (mpi_rank == 0)
+        {
+            const std::string dump_dirname = app_initializer->getVizDumpDirectory() + "/lag_data.cycle_000000";
+            const int num_files = (mpi_nodes + num_procs_per_file - 1) / num_procs_per_file;
+            for (int file = 0; file < num_files; ++file)
+            {
+                char temp_buf[16];
+                sprintf(temp_buf, "%04d", file);
+                const std::string file_name = dump_dirname + "/lag_data.proc_" + temp_buf + ".silo";
+                DBfile* dbfile = DBOpen(file_name.c_str(), DB_UNKNOWN, DB_READ);
+                if (!dbfile)
+                {
+                    pout << "could not open " << file_name << "\n";
+                    ++num_errors;
+                    continue;
+                }
+                for (int proc = file * num_procs_per_file;
+                     proc < std::min((file + 1) * num_procs_per_file, mpi_nodes);
+                     ++proc)
+                {
+                    DBSetDir(dbfile, "/");
+                    if (num_procs_per_file > 1)
+                    {
+                        sprintf(temp_buf, "%04d", proc);
+                        const std::string proc_dirname = std::string("processor_") + temp_buf;
+                        if (DBSetDir(dbfile, proc_dirname.c_str()) == -1)
+                        {
+                            pout << "missing directory " << proc_dirname << " in " << file_name << "\n";
+                            ++num_errors;
+                            continue;
+                        }
+                    }
+                    DBpointmesh* mesh =
+                        DBSetDir(dbfile, "level_0_cloud_0") == -1 ? NULL : DBGetPointmesh(dbfile, "mesh");
+                    if (!mesh || mesh->nels != num_markers || mesh->datatype != DB_FLOAT)
+                    {
+                        pout << "missing or malformed marker cloud of process " << proc << " in " << file_name
+                             << "\n";
+                        ++num_errors;
+                        if (mesh) DBFreePointmesh(mesh);
+                        continue;
+                    }
+                    for (int k = 0; k < num_markers; ++k)
+                    {
+                        const int lag_idx = proc * num_markers + k;
+                        for (unsigned int d = 0; d < NDIM; ++d)
+                        {
+                            const float* const coords = static_cast<const float*>(mesh->coords[d]);
+                            if (coords[k] != static_cast<float>(marker_posn(lag_idx, d))) ++num_errors;
+                        }
+                    }
+                    DBFreePointmesh(mesh);
+                }
+                DBClose(dbfile);
+            }
+
+            // The summary file must also have been written.
+            const std::string summary_file_name = dump_dirname + ".summary.silo";
+            DBfile* summary_file = DBOpen(summary_file_name.c_str(), DB_UNKNOWN, DB_READ);
+            if (summary_file)
+            {
+                DBClose(summary_file);
+            }
+            else
+            {
+                pout << "could not open " << summary_file_name << "\n";
+                ++num_errors;
+            }
+        }
+        num_errors = SAMRAI_MPI::sumReduction(num_errors);
+
+        ierr = AODestroy(&ao);
+        IBTK_CHKERRQ(ierr);
+
+        pout << "number of MPI processes per file: " << num_procs_per_file << "\n";
+        pout << "number of errors: " << num_errors << "\n";
+        test_passed = num_errors == 0;
+#else
+        pout << "Silo is not installed; skipping the LSiloDataWriter test.\n";
+#endif
+        pout << (test_passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main
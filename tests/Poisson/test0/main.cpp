@@ -0,0 +1,220 @@
+// Filename: main.cpp
+// Created on 17 Oct 2026
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+#include <ibtk/app_namespaces.h>
+
+/*******************************************************************************
+ * This test solves (rho/dt - mu*L) u = f for a sequence of time step sizes.   *
+ * For each new value of dt, the solution computed by a solver that has been   *
+ * updated in place via PoissonSolver::updatePoissonSpecifications() is        *
+ * compared to the solution computed by a freshly initialized solver.          *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool test_passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "poisson_update.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > v_cc_var = new CellVariable<NDIM, double>("v_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int v_cc_idx = var_db->registerVariableAndContext(v_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(v_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> v_vec("v", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+
+        u_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        v_vec.addComponent(v_cc_var, v_cc_idx, h_cc_idx);
+        f_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+
+        u_vec.setToScalar(0.0);
+        v_vec.setToScalar(0.0);
+
+        // Setup the right-hand side.
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+
+        // Read the test parameters.
+        const double rho = input_db->getDouble("RHO");
+        const double mu = input_db->getDouble("MU");
+        const double tol = input_db->getDouble("TOL");
+        const Array<double> dt_values = input_db->getDoubleArray("DT_VALUES");
+        TBOX_ASSERT(dt_values.getSize() > 1);
+
+        string solver_type = input_db->getString("solver_type");
+        Pointer<Database> solver_db = input_db->getDatabase("solver_db");
+        string precond_type = input_db->getString("precond_type");
+        Pointer<Database> precond_db = input_db->getDatabase("precond_db");
+
+        // Setup the solver that is updated in place whenever dt changes.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCConstant(rho / dt_values[0]);
+        poisson_spec.setDConstant(-mu);
+        RobinBcCoefStrategy<NDIM>* bc_coef = NULL;
+        Pointer<PoissonSolver> updated_solver = CCPoissonSolverManager::getManager()->allocateSolver(
+            solver_type, "updated_solver", solver_db, "", precond_type, "updated_precond", precond_db, "");
+        updated_solver->setPoissonSpecifications(poisson_spec);
+        updated_solver->setPhysicalBcCoef(bc_coef);
+        updated_solver->initializeSolverState(u_vec, f_vec);
+        updated_solver->solveSystem(u_vec, f_vec);
+
+        for (int k = 1; k < dt_values.getSize(); ++k)
+        {
+            const double dt = dt_values[k];
+            poisson_spec.setCConstant(rho / dt);
+            poisson_spec.setDConstant(-mu);
+
+            // Update the existing solver in place.
+            if (!updated_solver->updatePoissonSpecifications(poisson_spec))
+            {
+                pout << "dt = " << dt << ": solver could not be updated in place\n";
+                test_passed = false;
+                updated_solver->deallocateSolverState();
+                updated_solver->initializeSolverState(u_vec, f_vec);
+            }
+            u_vec.setToScalar(0.0);
+            updated_solver->solveSystem(u_vec, f_vec);
+
+            // Setup a fresh solver with the same coefficients.
+            Pointer<PoissonSolver> fresh_solver = CCPoissonSolverManager::getManager()->allocateSolver(
+                solver_type, "fresh_solver", solver_db, "", precond_type, "fresh_precond", precond_db, "");
+            fresh_solver->setPoissonSpecifications(poisson_spec);
+            fresh_solver->setPhysicalBcCoef(bc_coef);
+            fresh_solver->initializeSolverState(v_vec, f_vec);
+            v_vec.setToScalar(0.0);
+            fresh_solver->solveSystem(v_vec, f_vec);
+            fresh_solver->deallocateSolverState();
+
+            // Compare the two solutions.
+            const double v_norm = v_vec.maxNorm();
+            v_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&v_vec, false),
+                           Pointer<SAMRAIVectorReal<NDIM, double> >(&u_vec, false));
+            const double rel_diff = v_vec.maxNorm() / v_norm;
+            pout << "dt = " << dt << ": |u_updated - u_fresh|_oo / |u_fresh|_oo = " << rel_diff << "\n";
+            if (!(rel_diff <= tol)) test_passed = false;
+        }
+        updated_solver->deallocateSolverState();
+
+        pout << (test_passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main
@@ -0,0 +1,240 @@
+// Filename: main.cpp
+// Created on 17 Oct 2026
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscmat.h>
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <PoissonSpecifications.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/StaggeredStokesPETScMatUtilities.h>
+#include <ibamr/StaggeredStokesPETScVecUtilities.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+/*******************************************************************************
+ * This test checks that the values of a MAC Stokes matrix that are recomputed *
+ * by StaggeredStokesPETScMatUtilities::updatePatchLevelMACStokesOp() agree    *
+ * with those of a matrix built from scratch by                                *
+ * StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp().         *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool test_passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "stokes_mat.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create the DOF index variables and register them with the variable
+        // database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<SideVariable<NDIM, int> > u_dof_index_var = new SideVariable<NDIM, int>("u_dof_index");
+        Pointer<CellVariable<NDIM, int> > p_dof_index_var = new CellVariable<NDIM, int>("p_dof_index");
+
+        const int u_dof_index_idx = var_db->registerVariableAndContext(u_dof_index_var, ctx, IntVector<NDIM>(1));
+        const int p_dof_index_idx = var_db->registerVariableAndContext(p_dof_index_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Create boundary condition specification objects.
+        vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM, static_cast<RobinBcCoefStrategy<NDIM>*>(NULL));
+        const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift();
+        if (periodic_shift.min() == 0)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                ostringstream bc_coefs_name_stream;
+                bc_coefs_name_stream << "u_bc_coefs_" << d;
+                const string bc_coefs_name = bc_coefs_name_stream.str();
+
+                ostringstream bc_coefs_db_name_stream;
+                bc_coefs_db_name_stream << "VelocityBcCoefs_" << d;
+                const string bc_coefs_db_name = bc_coefs_db_name_stream.str();
+
+                u_bc_coefs[d] = new muParserRobinBcCoefs(
+                    bc_coefs_name, app_initializer->getComponentDatabase(bc_coefs_db_name), grid_geometry);
+            }
+        }
+
+        // Setup the two sets of velocity problem coefficients.
+        const double rho = input_db->getDouble("RHO");
+        const double mu = input_db->getDouble("MU");
+        const double dt_old = input_db->getDouble("DT_OLD");
+        const double dt_new = input_db->getDouble("DT_NEW");
+        const double tol = input_db->getDouble("TOL");
+
+        PoissonSpecifications u_problem_coefs_old("u_problem_coefs_old");
+        u_problem_coefs_old.setCConstant(rho / dt_old);
+        u_problem_coefs_old.setDConstant(-0.5 * mu);
+
+        PoissonSpecifications u_problem_coefs_new("u_problem_coefs_new");
+        u_problem_coefs_new.setCConstant(rho / dt_new);
+        u_problem_coefs_new.setDConstant(-0.5 * mu);
+
+        // Compare the updated and freshly constructed matrices on each level of
+        // the patch hierarchy.
+        const double data_time = 0.0;
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_dof_index_idx, data_time);
+            level->allocatePatchData(p_dof_index_idx, data_time);
+            vector<int> num_dofs_per_proc;
+            StaggeredStokesPETScVecUtilities::constructPatchLevelDOFIndices(
+                num_dofs_per_proc, u_dof_index_idx, p_dof_index_idx, level);
+
+            // Build a matrix for the old coefficients and then update it in
+            // place for the new coefficients.
+            Mat updated_mat = NULL;
+            StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(updated_mat,
+                                                                             u_problem_coefs_old,
+                                                                             u_bc_coefs,
+                                                                             data_time,
+                                                                             num_dofs_per_proc,
+                                                                             u_dof_index_idx,
+                                                                             p_dof_index_idx,
+                                                                             level);
+            StaggeredStokesPETScMatUtilities::updatePatchLevelMACStokesOp(updated_mat,
+                                                                          u_problem_coefs_new,
+                                                                          u_bc_coefs,
+                                                                          data_time,
+                                                                          num_dofs_per_proc,
+                                                                          u_dof_index_idx,
+                                                                          p_dof_index_idx,
+                                                                          level);
+
+            // Build a matrix for the new coefficients from scratch.
+            Mat fresh_mat = NULL;
+            StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(fresh_mat,
+                                                                             u_problem_coefs_new,
+                                                                             u_bc_coefs,
+                                                                             data_time,
+                                                                             num_dofs_per_proc,
+                                                                             u_dof_index_idx,
+                                                                             p_dof_index_idx,
+                                                                             level);
+
+            // Compute |A_updated - A_fresh|_oo / |A_fresh|_oo.  The nonzero
+            // patterns are not assumed to agree so that any entries that are
+            // missing from the updated matrix also show up in the difference.
+            int ierr;
+            double fresh_norm, diff_norm;
+            ierr = MatNorm(fresh_mat, NORM_INFINITY, &fresh_norm);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatAXPY(updated_mat, -1.0, fresh_mat, DIFFERENT_NONZERO_PATTERN);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatNorm(updated_mat, NORM_INFINITY, &diff_norm);
+            IBTK_CHKERRQ(ierr);
+            const double rel_diff = diff_norm / fresh_norm;
+            pout << "level " << ln << ": |A_updated - A_fresh|_oo / |A_fresh|_oo = " << rel_diff << "\n";
+            if (!(rel_diff <= tol)) test_passed = false;
+
+            ierr = MatDestroy(&updated_mat);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatDestroy(&fresh_mat);
+            IBTK_CHKERRQ(ierr);
+            level->deallocatePatchData(u_dof_index_idx);
+            level->deallocatePatchData(p_dof_index_idx);
+        }
+
+        pout << (test_passed ? "PASSED" : "FAILED") << "\n";
+
+        // Cleanup boundary condition specification objects (when necessary).
+        for (unsigned int d = 0; d < NDIM; ++d) delete u_bc_coefs[d];
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main